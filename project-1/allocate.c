@@ -18,194 +18,78 @@
 #include <limits.h>
 
 /* Accompanying libraries created to facilitate the simulation */
-#include "queue.h"
-#include "list.h"
+#include "trace.h"
+#include "stats.h"
+#include "output.h"
+#include "sweep.h"
+#include "sched.h"
+#include "executor.h"
+#include "plan.h"
+#include "bounds.h"
+#include "optimal.h"
+#include "options.h"
 
 /* Global variables that helps structure my code */
-#define LINEMAX 1024
-#define MINTOTALSTDIN 4
-#define MAXTOTALSTDIN 7
-#define FILEFLAG "-f"
-#define NPROCESSOR "-p"
 #define ELEMENTS 5
 #define SINGLE_PROCESSOR 1
-#define CHALLENGE "-c"
-
-/* Reads from stdin in the form :
-   './allocate (executeable main) -f testfilepath -p n (number of processes)'.
-   An optional  '-c' would then work and manipulate the scheduler to reduce the makespan.
-   The -f and -p flag can come in any order. Stores the nprocessor and the filepath.
-   Returns filepath. */
-char *readfromstdin(int argc, char *argv[], int *nprocessor, char *filepath, int *challenge)
+#define NS_PER_US 1000
+#define CONVERT "--convert"
+#define CONVERTSTDIN 4
+
+/* Loads the file at filepath, exiting if it cannot be read or has a
+   malformed line. Stores all information onto a trace which also takes
+   note of total execution time and count. When streaming (and not planning for the
+   challenge, bounding the run or comparing runs, which need every process)
+   the file is left to the trace to read as the simulation goes.
+   Returns the trace. */
+Trace *readfile(char *filepath, int needall, int stream)
 {
-    int argument = 0;
-
-    // read from stdin
-    if (argc > MINTOTALSTDIN && argc < MAXTOTALSTDIN)
+    if (stream == 1 && needall == 0)
     {
-        for (argument = 1; argument < argc; argument++)
+        FILE *file1 = fopen(filepath, "r"); // filepath used to read the file
+        if (file1 == NULL)
         {
-            // check '-f' flag (any order)
-            if (strcmp(argv[argument], FILEFLAG) == 0)
-            {
-                // store the filepath
-                filepath = argv[argument + 1];
-            }
-            else if (strcmp(argv[argument], NPROCESSOR) == 0)
-            {
-                // check for '-p' flag (any order), convert to integer
-                (*nprocessor) = atoi(argv[argument + 1]);
-            }
-            else if (strcmp(argv[argument], CHALLENGE) == 0)
-            {
-                // if the own scheduling algorithm prompted by '-c' works
-                (*challenge) = 1;
-            }
+            fprintf(stderr, "Unable to open the file %s!\n", filepath);
+            exit(EXIT_FAILURE);
         }
-    }
-    else
-    {
-        // incorrect reading from stdin exception
-        fprintf(stderr, "Not enough arguments are present : Expected atleast 4 (inclusive of challenge flag)!");
-    }
-    return filepath;
-}
 
-/* Reads the filepath onto a filereader, opening and reading line by line.
-   Stores all information onto a read-in queue and initializes the other
-   relevant fields and takes note of total execution time and count.
-   Returns the read-in queue. */
-Queue *readfile(char *filepath, Queue *readinqueue, int *totalexecutiontime, int *count, int challenge)
-{
-    FILE *file1;
-    char inputfile[LINEMAX] = "";
-    Data data;
-
-    file1 = fopen(filepath, "r"); // filepath used to read the file
-
-    //store the values in a readyqueue
-    //readinqueue = new_queue();
-
-    while (fgets(inputfile, LINEMAX, file1))
-    {
-        // read arrivaltime, processid, executiontime, parallelisability
-        sscanf(inputfile, "%d %lf %4d %c\n", &data.arrivaltime, &data.processid, &data.executiontime, &data.parallelisable);
-        // intialize the rest of the fields
-        data.remainingtime = data.executiontime;
-        data.completiontime = 0; // changed this now!
-        data.timeoverhead = 0;
-        data.turnaroundtime = 0.00;
-        data.totalremainingtime = 0;
-        data.parentid = -1;             //data.processid;
-        data.parentexecutiontime = -1;  //= data.executiontime;
-        data.parentarrivaltime = -1;    // = data.parentarrivaltime;
-        data.parentcompletiontime = -1; // = 0;
-        data.parentturnaroundtime = -1; //= 0.00;
-        data.parenttimeoverhead = -1;   //= 0;
-        // store the values into the corresponding queue
-        if(!readinqueue)
+        // a binary trace is paged in as it is read anyway, so map it instead
+        if (!trace_is_binary(file1))
         {
-          readinqueue = new_queue();
+            return new_trace_stream(file1, filepath);
         }
-        queue_enqueue(readinqueue, data);
-        // record the totalexecutiontime and count needed later
-        (*totalexecutiontime) += data.executiontime;
-        (*count)++;
+        fclose(file1);
     }
-    fclose(file1);
 
-    if (challenge == 1)
+    // malformed lines have already been reported with their line numbers
+    Trace *trace = load_trace(filepath);
+    if (trace == NULL)
     {
-        // loop and store the arrival times
-        int tmparrivaltimes[*count];
-
-        int i = 0;
-        Node *node = readinqueue->items->head;
-        while ((i < *count) && node)
-        {
-            tmparrivaltimes[i] = node->data.arrivaltime;
-            i++;
-            node = node->next;
-        }
-        free(node);
-
-        // sort in descending order of execution time
-        bubbleSortbyExecutionTime(readinqueue);
-
-        // re enter the arrival times back
-        // the aim is to make the heavy processes finish first
-        int a = 0;
-        Node *newnode = readinqueue->items->head;
-        while ((a < *count) && newnode)
-        {
-            newnode->data.arrivaltime = tmparrivaltimes[a];
-            a++;
-            newnode = newnode->next;
-        }
-        free(newnode);
+        fprintf(stderr, "Unable to read the processes in %s!\n", filepath);
+        exit(EXIT_FAILURE);
     }
 
-    return readinqueue;
+    return trace;
 }
 
-/* Finds the sum of the unique processes and subprocesses. */
-int find_unique_process_subprocess(int unique[], int index, int curr_queue_size)
+/* Converts the text trace at inpath into a binary trace at outpath, which
+   loads without any parsing. Exits if either file cannot be used, or the
+   trace has a process a binary trace would be rejected for. */
+void convert_trace(char *inpath, char *outpath)
 {
-    int counts = 0;
-    int freq[index];
-    // set the frequency array to -1
-    for (int i = 0; i < index; i++)
+    Trace *trace = readfile(inpath, 0, 0);
+    // checked as the binary trace will be when it is loaded
+    if (check_trace(trace) > 0)
     {
-        freq[i] = -1;
-    }
-
-    // find frequency of each element 
-    for (int j = 0; j < index; j++)
-    {
-        counts = 1;
-        for (int k = j + 1; k < index; k++)
-        {
-            if (unique[j] == unique[k])
-            {
-                counts++;
-                freq[k] = 0;
-            }
-        }
-        if (freq[j] != 0)
-        {
-            freq[j] = counts;
-        }
+        fprintf(stderr, "Unable to convert the processes in %s!\n", inpath);
+        exit(EXIT_FAILURE);
     }
-    
-    // find the number of frequent elements
-    // eg [pid1 pid1 pid2 pid ] = [2 2] = 2 unique processes
-    for (int l = 0; l < index; l++)
+    if (!write_trace_binary(trace, outpath))
     {
-        if (freq[l] > 0)
-        {
-            curr_queue_size += 1;
-        }
+        fprintf(stderr, "Unable to write the file %s!\n", outpath);
+        exit(EXIT_FAILURE);
     }
-    return curr_queue_size;
-}
-
-/* A handy function to help find total processes.*/
-int totalprocess(Queue *readyqueue[], int nprocessor)
-{
-    int i = 0;
-    int totalprocesses = 0;
-    // loop through readyqueues
-    for (i = 0; i < nprocessor; i++)
-    {
-        // collect sums of the processes
-        Node *node = readyqueue[i]->items->head;
-        while (node)
-        {
-            totalprocesses += 1;
-            node = node->next;
-        }
-    }
-    return totalprocesses;
+    free_trace(trace);
 }
 
 /* Takes in a double value.
@@ -221,767 +105,455 @@ double roundupdouble(double maxturnaroundtime)
     return maxturnaroundtime;
 }
 
-/* Fills up the arrival, executiontime, completion, turnaround and timeoverheads. */
-void store_stats(int arrivaltimes[], int executiontimes[], int completiontimes[], int turnaroundtimes[], double timeoverheads[], int index, int arrivaltime, int executiontime, int time)
+/*  Uses the statistics folded in from every finished process to print
+    out maximum, average timeoverheads, turnaroundtime, makespan for the
+    simulation, and unless bounds is NULL how far the turnaroundtime and
+    makespan are at most from the best possible */
+void printoutstats(Stats *stats, const Bounds *bounds)
 {
-    arrivaltimes[index] = arrivaltime;
-    executiontimes[index] = executiontime;
-    completiontimes[index] = time;
-    turnaroundtimes[index] = completiontimes[index] - arrivaltimes[index];
-    timeoverheads[index] = (double)turnaroundtimes[index] / executiontimes[index];
+    // it was not properly rounding up the maxturnaroundtime
+    double maxturnaroundtime = roundupdouble(stats->maxtimeoverhead);
+
+    printf("Turnaround time %lld\n", (long long)ceil(stats_average_turnaround(stats)));
+    printf("Time overhead %.2f %.2f\n", maxturnaroundtime, stats_average_overhead(stats));
+    printf("Makespan %lld\n", stats->makespan);
+
+    if (bounds != NULL)
+    {
+        double turnaroundtime = stats_average_turnaround(stats);
+        printf("Turnaround time lower bound %lld (gap %.2f%%)\n", (long long)ceil(bounds->turnaroundtime),
+            bounds->turnaroundtime > 0 ? 100 * (turnaroundtime - bounds->turnaroundtime) / bounds->turnaroundtime : 0.0);
+        printf("Makespan lower bound %lld (gap %.2f%%)\n", bounds->makespan,
+            bounds->makespan > 0 ? 100.0 * (stats->makespan - bounds->makespan) / bounds->makespan : 0.0);
+    }
 }
 
-/* Marks of fields of process done to signify a subprocess has finished. */
-void process_done_processes_parallel(CompressedData*process_done, int index, int parent_id)
+/* Prints out the 50th, 90th, 99th and 99.9th percentiles of the turnaround
+   times and time overheads, each to within 1% of the exact value. */
+void printoutpercentiles(Stats *stats)
 {
-    // mark for the first time
-    if (process_done[index].number_child == -1)
+    double percentiles[] = {50, 90, 99, 99.9};
+    int npercentiles = sizeof(percentiles) / sizeof(percentiles[0]);
+
+    printf("Turnaround time percentiles");
+    for (int i = 0; i < npercentiles; i++)
     {
-        process_done[index].number_child = 1;
+        printf(" p%g %lld", percentiles[i], histogram_percentile(&stats->turnaroundtimes, percentiles[i]));
     }
-    else
+    printf("\nTime overhead percentiles");
+    for (int i = 0; i < npercentiles; i++)
     {
-        // mark of and add up to a previous subprocess finished
-        process_done[index].number_child += 1;
+        printf(" p%g %.2f", percentiles[i], (double)histogram_percentile(&stats->timeoverheads, percentiles[i]) / OVERHEAD_SCALE);
     }
-    process_done[index].parentid = parent_id; // parent id stored
-    process_done[index].subprocess = 1; // flag to indicate a subprocess exist
+    printf("\n");
 }
 
-/* For a given index corresponding readyqueue corresponding to a cpu a generic function to add values */
-void process_done_processes_non_parallel(CompressedData*process_done, int index, int value)
+/* It is fed with time stamp, processid (and which subprocess), remaining
+   time of the processor and the processor it is currently running.
+   Prints out the 'running' command as per specification onto output,
+   unless there is no output as the run is quiet. */
+void print_running(Output *output, long long time, int pid, int child, long long remainingtime, int index, char parallelisable)
 {
-    process_done[index].number_child = value;
-    process_done[index].parentid = value;
-    process_done[index].subprocess = value;
+    if (output == NULL || (parallelisable != 'n' && parallelisable != 'p'))
+    {
+        return;
+    }
+    output_integer(output, time);
+    output_string(output, ",RUNNING,pid=");
+    // whole pid for a process, the parent's pid and which one for a subprocess
+    output_processid(output, pid, child, parallelisable == 'p');
+    output_string(output, ",remaining_time=");
+    output_integer(output, remainingtime);
+    output_string(output, ",cpu=");
+    output_integer(output, index);
+    output_string(output, "\n");
 }
 
-/* Initialise the process ids to default values. */
-void initialise_process_done(CompressedData *process_done, int maxpid)
+/* It is fed with time stamp, processid and the count of the
+   processes remaining.
+   Prints out the 'finished' command as per specification onto output,
+   unless there is no output as the run is quiet. */
+void print_finished(Output *output, long long time, int pid, int processremaining)
 {
-    // setting the default fields to -1
-    // maxpid refers to the maximum value of process id (pid) 
-    // found while reading from stdin
-    for (int i = 0; i < maxpid; i++)
+    if (output == NULL)
     {
-        process_done[i].parentid = -1;
-        process_done[i].number_child = -1;
-        process_done[i].subprocess = -1;
+        return;
     }
+    output_integer(output, time);
+    output_string(output, ",FINISHED,pid=");
+    output_integer(output, pid);
+    output_string(output, ",proc_remaining=");
+    output_integer(output, processremaining);
+    output_string(output, "\n");
 }
 
-/*  Uses the count as number of processes,their turnaroundtimes,
-    timeoverheads and total execution time to print out maximum,
-    average timeoverheads, turnaroundtime, makespan for the simulation */
-void printoutstats(int count, int nprocessor, int turnaroundtime[], double timeoverhead[], int time)
+/* Receives each event of a simulation and prints it out onto the output
+   given as the context. */
+void print_event(const SchedEvent *event, void *context)
 {
-    int i = 0;
-    int j = 0;
-    double averageturnaroundtime = 0.00;
-    double averagetimeoverhead = 0.00;
-    double maxturnaroundtime = 0.00;
-
-    for (i = 0; i < count; i++)
+    Output *output = context;
+    if (event->type == SCHED_RUNNING)
     {
-        if (turnaroundtime[i] != -1)
-        {
-            averageturnaroundtime += turnaroundtime[i];
-        }
+        print_running(output, event->time, event->processid, event->child, event->remainingtime, event->cpu, event->parallelisable);
     }
-
-    int counter = 0;
-    for (j = 0; j < count; j++)
+    else if (event->type == SCHED_FINISHED)
     {
-        if (timeoverhead[j] != -1.00)
-        {
-            averagetimeoverhead += timeoverhead[j];
-            if (maxturnaroundtime < timeoverhead[j])
-            {
-                maxturnaroundtime = timeoverhead[j];
-            }
-            counter++;
-        }
+        print_finished(output, event->time, event->processid, event->proc_remaining);
     }
-
-    // it was not properly rounding up the maxturnaroundtime
-    maxturnaroundtime = roundupdouble(maxturnaroundtime);
-
-    printf("Turnaround time %d\n", (int)ceil(averageturnaroundtime / counter));
-    printf("Time overhead %.2f %.2f\n", maxturnaroundtime, averagetimeoverhead / counter);
-    printf("Makespan %d\n", time);
 }
 
-/* It is fed with time stamp, processid, remaining time of the
-   processor and the processor it is currently running.
-   Prints out the 'running' command as per specification. */
-void print_running(int time, double pid, int remainingtime, int index, char parallelisable)
+/* Writes every segment of a log to the file at filepath, one
+   'cpu,pid,start,end' line each in the order they ended, exiting if the
+   file cannot be written. */
+void write_segments(SegmentLog *segments, const char *filepath)
 {
-    // typecast for printing in non parallel state - process
-    if (parallelisable == 'n')
-    {
-        printf("%d,RUNNING,pid=%d,remaining_time=%d,cpu=%d\n", time, (int)pid, remainingtime, index);
-    }
-    else if (parallelisable == 'p')
-    {
-         // typecast for printing in parallel state - subprocess
-        printf("%d,RUNNING,pid=%.1f,remaining_time=%d,cpu=%d\n", time, pid, remainingtime, index);
-    }
+    FILE *file = fopen(filepath, "w");
+    if (file == NULL)
+    {
+        fprintf(stderr, "Unable to open the file %s!\n", filepath);
+        exit(EXIT_FAILURE);
+    }
+    Output *output = new_output(file);
+    output_string(output, "cpu,pid,start,end\n");
+    for (int i = 0; i < segmentlog_size(segments); i++)
+    {
+        const Segment *segment = segmentlog_get(segments, i);
+        output_integer(output, segment->cpu);
+        output_string(output, ",");
+        output_processid(output, segment->processid, segment->child, segment->parallelisable == 'p');
+        output_string(output, ",");
+        output_integer(output, segment->start);
+        output_string(output, ",");
+        output_integer(output, segment->end);
+        output_string(output, "\n");
+    }
+    free_output(output);
+    fclose(file);
 }
 
-/* It is fed with time stamp, processid and the count of the
-   processes remaining.
-   Prints out the 'finished' command as per specification. */
-void print_finished(int time, int pid, int processremaining)
+/* Scheduling algorithm implementation done here, shortest remaining time
+   first unless another policy is given.
+   Time advances from event to event (arrivals and completions), it stores
+   the processes in a ready queue and whenever any incoming process finds
+   a spot, it overtakes the cpu. With stealing, idle cpus take work waiting
+   on the others, and with gang the subprocesses of a process run together.
+   The events go to callback with context, unless it is NULL, the segments
+   run onto segments, unless it is NULL, and the statistics of every
+   finished process end up in stats.
+   Everything it changes belongs to this run, so runs on the same trace
+   can go at the same time. */
+void simulate(Trace *trace, int nprocessor, const Policy *policy, const Split *split, int gang, int stealing, SchedCallback callback, void *context, SegmentLog *segments, Stats *stats)
 {
-    printf("%d,FINISHED,pid=%d,proc_remaining=%d\n", time, pid, processremaining);
-}
+    int nextarrival = 0; // position of the next process to arrive
+    Simulator *sim = sched_new(nprocessor, callback, context);
+    sched_set_policy(sim, policy);
+    sched_set_split(sim, split);
+    sched_set_gang(sim, gang);
+    sched_set_stealing(sim, stealing);
+    sched_set_segmentlog(sim, segments);
 
-/*  Finds the queue size of the existing processes (subprocesses inclusive) waiting on the readyqueue.
-    Returns the total size of the sum of processes and subprocesses running. */
-int find_queue_size(Queue *readyqueue[], int nprocessor, int unique_subprocess[], int unique_process[])
-{
-    // variable declaration
-    int process_exist = 0;
-    int subprocess_exist = 0;
-    int process_index = 0;
-    int subprocess_index = 0;
-    int curr_queue_size = 0;
-   
-    // go through the readyqueues
-    for (int i = 0; i < nprocessor; i++)
-    {
-        // if readyqueue still has processes
-        if (queue_size(readyqueue[i]) > 0)
+    // Main brain of the strf algorithm.
+    // Each process is submitted once the one before it is, and the clock
+    // runs up to just before the next one listed arrives, so every process
+    // due at an instant is known before that instant is run.
+    Process *process;
+    while ((process = trace_peek(trace, nextarrival)) != NULL)
+    {
+        sched_submit(sim, *process);
+        nextarrival++;
+        process = trace_peek(trace, nextarrival);
+        if (process != NULL && process->arrivaltime > 0)
         {
-            Node *node = readyqueue[i]->items->head;
-            while (node)
-            {
-                // if not filled
-                if (node->data.parentid == -1)
-                {
-                    // fill up
-                    unique_process[process_index] = node->data.processid;
-                    // increase counter
-                    process_index++;
-                    // set flag to true
-                    process_exist = 1;
-                }
-                else
-                {
-                    // if subprocess then grab parent pid
-                    unique_subprocess[subprocess_index] = node->data.parentid;
-                    // increment counter
-                    subprocess_index++;
-                    // set flag true for subprocess
-                    subprocess_exist = 1;
-                }
-                node = node->next;
-            }
+            sched_advance_to(sim, process->arrivaltime - 1);
         }
     }
-    
-    // delegate and find the processes waiting in the readyqueue
-    if (process_exist == 1)
-    {
-        curr_queue_size = find_unique_process_subprocess(unique_process, process_index, curr_queue_size);
-    }
-    
-    // delegate and find the subprocesses waiting in the readyqueue
-    if (subprocess_exist == 1)
-    {
-        curr_queue_size = find_unique_process_subprocess(unique_subprocess, subprocess_index, curr_queue_size);
-    }
-    return curr_queue_size;
+
+    // all processes in, run until the last of them finishes
+    sched_drain(sim);
+    *stats = *sched_stats(sim);
+    sched_free(sim);
 }
 
-/* Takes the parent process's data and number of processes = k
-   to update the subprocesses' fields.
-   Returns the parent process with child encapsulated. */
-Data *create_subprocess(Data *dataarray, Data newdata, int k)
+/* Simulates a run of a sweep, which only needs the statistics. */
+void simulate_quietly(Trace *trace, int nprocessor, Stats *stats)
 {
-    for (int i = 0; i < k; i++)
-    {
-        // copy parent's data to child
-        dataarray[i] = newdata; 
-        // prev pid becomes parent
-        dataarray[i].parentid = (int)newdata.processid;
-        // pid in increments of 0.1
-        dataarray[i].processid = (newdata.processid + (i * 0.1)); 
-        //updated execution time
-        dataarray[i].executiontime = (ceil(((double)newdata.executiontime) / k) + 1); 
-        // rest copied from parent to child
-        dataarray[i].remainingtime = dataarray[i].executiontime;
-        dataarray[i].parentexecutiontime = newdata.executiontime;
-        dataarray[i].parentarrivaltime = newdata.arrivaltime;
-        dataarray[i].parentcompletiontime = newdata.completiontime;
-        dataarray[i].parentturnaroundtime = newdata.turnaroundtime;
-        dataarray[i].parenttimeoverhead = newdata.timeoverhead;
-    }
-    return dataarray;
+    Policy policy = srtf_policy();
+    Split split = all_split();
+    simulate(trace, nprocessor, &policy, &split, 0, 0, NULL, NULL, NULL, stats);
 }
 
-/* The program schedules the process to the cpu. 
-   Prints out a running statement.
-   Returns the queued up cpu (basically a stacked up linked list). */
-Queue **schedule_cpu(Queue *cpu[], Data newdata, int time, int index)
+/* Plans a run of a sweep for the challenge, which only needs the statistics. */
+void plan_quietly(Trace *trace, int nprocessor, Stats *stats)
 {
-    // append to cpu at the tail or head if first insertion
-    queue_enqueue(cpu[index], newdata);
-    // run the print command
-    print_running(time, newdata.processid, newdata.remainingtime, index, newdata.parallelisable);
-    return cpu;
+    Plan *plan = new_plan(trace, nprocessor);
+    plan_improve(plan, PLAN_SEARCH_BUDGET);
+    plan_run(plan, NULL, NULL, stats);
+    free_plan(plan);
 }
 
-/* Finds the processor with the minimum remaining time. 
-   Returns the index of that processor. */
-int find_cpu(int nprocessor, Queue *readyqueue[])
+/* Reruns the trace under policy with each way of splitting parallelisable
+   processes, a fixed split only as split has it, and prints the turnaround
+   time and makespan of each. */
+void compare_splits(Trace *trace, int nprocessor, const Policy *policy, const Split *split, int gang, int stealing)
 {
-    // empty cpus given priorities first
-    for (int i = 0; i < nprocessor; i++)
+    const char *names[] = {"all", "work", "cost"};
+    int nnames = sizeof(names) / sizeof(names[0]);
+    for (int i = 0; i <= nnames; i++)
     {
-        if (queue_size(readyqueue[i]) == 0)
+        Split each;
+        if (i < nnames)
         {
-            return i;
+            find_split(names[i], &each);
         }
-    }
-
-    
-    int min = INT_MAX;
-    int index = 0;
-    // for every readyqueue thats filled
-    for (int a = 0; a < nprocessor; a++)
-    {
-        if (queue_size(readyqueue[a]) > 0)
+        else if (split->k > 0)
         {
-            // loop and find the remaining total remaining time
-            Node *node = readyqueue[a]->items->head;
-            int totalremainingtime = 0;
-            while (node)
-            {
-                totalremainingtime += node->data.remainingtime;
-                node = node->next;
-            }
-            free(node);
-            // only collect the minimum remaining time of the given cpus
-            if (min > totalremainingtime)
-            {
-                min = totalremainingtime;
-                index = a;
-            }
+            each = *split;
         }
-    }
-    return index;
-}
-
-/* It removes the finished process from the readyqueue and then stores the 
-   relevant informations in their particular array. 
-   Prints out a finished statement of the cpu. */
-void finished_process(Queue *readyqueue[], int nprocessor, int arrivaltime[], int executiontime[], int completiontime[], int turnaroundtime[], double timeoverhead[], int time, CompressedData *process_done, Data finisheddata)
-{
-    int curr_queue_size = 0;
-    int totalprocesses = totalprocess(readyqueue, nprocessor);
-    int unique_subprocess[totalprocesses]; // max queuesize
-    int unique_process[totalprocesses];
-
-    if (finisheddata.parallelisable == 'n')
-    { 
-        // mark off process (done) array
-        process_done_processes_non_parallel(process_done, (int)finisheddata.processid, 0);
-        
-        // store and record of the stats of the  process
-        store_stats(arrivaltime, executiontime, completiontime, turnaroundtime, timeoverhead, (int)finisheddata.processid - 1, finisheddata.arrivaltime, finisheddata.executiontime, time);
-
-        // queue size found
-        curr_queue_size = find_queue_size(readyqueue, nprocessor, unique_subprocess, unique_process);
-
-        // print off the finished process
-        print_finished(time, finisheddata.processid, curr_queue_size);
-    }
-    else if (finisheddata.parallelisable == 'p')
-    {
-        // mark off subprocesses (done) array
-        process_done_processes_parallel(process_done, (int)finisheddata.processid, finisheddata.parentid);
-        //if all children popped off
-        if ((process_done[(int)finisheddata.processid].number_child == nprocessor) && (process_done[(int)finisheddata.processid].subprocess == 1))
+        else
         {
-            // store and record of the stats of the parent process
-            store_stats(arrivaltime, executiontime, completiontime, turnaroundtime, timeoverhead, process_done[(int)finisheddata.processid].parentid - 1, finisheddata.parentarrivaltime, finisheddata.parentexecutiontime, time);
-
-            // queue size found of current unfinished subprocesses and processes in readyqueue
-            curr_queue_size = find_queue_size(readyqueue, nprocessor, unique_subprocess, unique_process);
-
-            // print off the finished process
-            print_finished(time, process_done[(int)finisheddata.processid].parentid, curr_queue_size);
+            break;
         }
-    }
-}
 
-/* Checks if any of the readyqueue is empty 
-   Returns true if atleast 1 readyqueue is empty. */
-int anyemptyqueue(Queue **readyqueue, int nprocessor)
-{
-    int empty = 0;
-    // any readyqueue first encountered as empty returned
-    for (int i = 0; i < nprocessor; i++)
-    {
-        if (queue_size(readyqueue[i]) == 0)
+        Stats stats;
+        simulate(trace, nprocessor, policy, &each, gang, stealing, NULL, NULL, NULL, &stats);
+        printf("Split %s", each.name);
+        if (each.k > 0)
         {
-            return 1;
+            printf(":%d", each.k);
         }
-    }
-    return empty;
-}
-
-/* Set all the elements in the double array to default '-1.00'. */
-void initialise_array_defaults_double(double doublearray[], int count)
-{
-    int i = 0;
-    for (i = 0; i < count; i++)
-    {
-        doublearray[i] = -1.00;
+        printf(" turnaround time %lld makespan %lld\n", (long long)ceil(stats_average_turnaround(&stats)), stats.makespan);
     }
 }
 
-/* Set all the elements in the integer array to default '-1'. */
-void initialise_array_defaults_integer(int integerarray[], int count)
+/* Receives each event of a simulation and adds up the turnaround times of
+   the processes split into more than one subprocess onto the two totals
+   given as the context: the sum of the times and the count. */
+void add_parallel_turnaround(const SchedEvent *event, void *context)
 {
-    int i = 0;
-    for (i = 0; i < count; i++)
+    double *totals = context;
+    // a process split into one subprocess has nothing to run together
+    if (event->type == SCHED_FINISHED && event->nchild > 1)
     {
-        integerarray[i] = -1;
+        totals[0] += event->time - event->arrivaltime;
+        totals[1] += 1;
     }
 }
 
-/* Accepts arrays and their length and initialises with respective default values.
-  -1 for integer array and -1.00 for double array. */
-void initialise_arrays(int arrivaltime[],int executiontime[],int completiontime[],int turnaroundtime[], double timeoverhead[], int count)
+/* Reruns the trace under policy with the subprocesses of each process run
+   independently and then together, and prints the average turnaround time
+   of the processes split into more than one under each. */
+void compare_gang(Trace *trace, int nprocessor, const Policy *policy, const Split *split, int stealing)
 {
-    // delegation to int array default fill up
-    initialise_array_defaults_integer(arrivaltime,count);
-    initialise_array_defaults_integer(executiontime,count);
-    initialise_array_defaults_integer(completiontime,count);
-    initialise_array_defaults_integer(turnaroundtime,count);
-    // delegation to double array default fill up
-    initialise_array_defaults_double(timeoverhead,count);
+    double turnaround[2];
+    for (int gang = 0; gang <= 1; gang++)
+    {
+        Stats stats;
+        double totals[2] = {0, 0};
+        simulate(trace, nprocessor, policy, split, gang, stealing, add_parallel_turnaround, totals, NULL, &stats);
+        turnaround[gang] = (totals[1] > 0) ? totals[0] / totals[1] : 0;
+    }
+    double change = (turnaround[0] > 0) ? 100 * (turnaround[1] - turnaround[0]) / turnaround[0] : 0;
+    printf("Parallelisable turnaround time %lld gang, %lld independent (%.2f%% %s)\n",
+        (long long)ceil(turnaround[1]), (long long)ceil(turnaround[0]),
+        fabs(change), (change > 0) ? "higher" : "lower");
 }
 
-/* Readins the readinqueue to find the maximum processid.
-   Returns maximum processid. */
-int find_max_pid(Queue *readinqueue)
+/* Runs the simulation on the trace as the options say, under their policy,
+   printing every event unless quiet. A quiet run leaves out the events.
+   With stealing, idle cpus take work waiting on the others.
+   Parallelisable processes are split as the split chooses, and run together
+   with gang.
+   The run segments are written to the segment path unless it is NULL.
+   Later the statistics of the simulation printed out, with their
+   percentiles, the gap to the best possible, how the other splits do and
+   how gang compares with running independently if asked for. */
+void strf(Trace *trace, const Options *options)
 {
-    Node *node = readinqueue->items->head;
-    int maxpid = 0;
-    // loop and grab the maximum pid if existant is less
-    while (node)
-    {
-        if (maxpid < (int)node->data.processid)
-        {
-            maxpid = (int)node->data.processid;
-        }
-        node = node->next;
-    }
-    return maxpid;
-}
+    Stats stats;
+    int nprocessor = options->nprocessor;
+    const Policy *policy = &options->policy;
+    const Split *split = &options->split;
+    Output *output = options->quiet ? NULL : new_output(stdout); // the running and finished lines
+    SegmentLog *segments = options->segmentpath ? new_segmentlog(nprocessor) : NULL;
 
-/* Checks if all the readyqueues are empty or not which is indicative
-   of whether all processes have been scheduled to the cpu or not.
-   Returns a flag in integer of whether the entire readyqueue is empty. */
-int allemptyqueue(Queue **readyqueue, int nprocessor)
-{
-    int emptycount = 0;
-    // loop to grab the empty readyqueues (size = 0)
-    for (int i = 0; i < nprocessor; i++)
+    simulate(trace, nprocessor, policy, split, options->gang, options->stealing, output ? print_event : NULL, output, segments, &stats);
+    if (segments != NULL)
     {
-        if (queue_size(readyqueue[i]) == 0)
-        {
-            emptycount++;
-        }
+        write_segments(segments, options->segmentpath);
+        free_segmentlog(segments);
     }
-    return emptycount == nprocessor;
-}
 
-/* Updates, inserts into cpu the finished processes.
-   Returns cpu and readyqueue with the updated insertion. */
-Queue **update_readyqueue_cpu(Queue *readyqueue[], Queue *cpu[], int nprocessor, int arrivaltime[], int executiontime[], int completiontime[], int turnaroundtime[], double timeoverhead[], int time, CompressedData *process_done)
-{
-    int process_pop = 0;
-
-    // loop and update the remaining time of readyqueues
-    for (int t = 0; t < nprocessor; t++)
+    // all necessary statistics are calculated, after the lines buffered
+    if (output != NULL)
     {
-        if (queue_size(readyqueue[t]) != 0)
-        {
-            readyqueue[t]->items->head->data.remainingtime -= 1;
-        }
+        free_output(output);
     }
-
-    // check for when the processes finish and collect them, handy for collecting all 
-    // simultaneous finishes
-    Data* processes_completed = NULL;
-    int insertion = 0;
-    for (int t = 0; t < nprocessor; t++)
+    Bounds bounds;
+    if (options->gap)
     {
-        if(queue_size(readyqueue[t])!=0)
-        {
-            if (readyqueue[t]->items->head->data.remainingtime == 0)
-            {
-                Data finisheddata = queue_dequeue(readyqueue[t]);
-                // allocate fresh memories to collect completed processes
-                processes_completed = realloc(processes_completed, sizeof(Data)*(insertion+1));
-                processes_completed[insertion] = finisheddata;
-                // know how much finished for later looping
-                insertion++;
-                // flag to indicate processes finished
-                process_pop = 1;
-            }
-        }
+        compute_bounds(trace, nprocessor, split, &bounds);
     }
-    
-    // check if there are processes finished, then collect stats and print
-    if(process_pop==1)
+    printoutstats(&stats, options->gap ? &bounds : NULL);
+    if (options->percentiles)
     {
-        // calculate, store and mark of processes done
-        for(int u= 0; u < insertion;u++)
-        {
-            // delegation to finished process
-            finished_process(readyqueue, nprocessor, arrivaltime, executiontime, completiontime, turnaroundtime, timeoverhead, time, process_done, processes_completed[u]);
-        }
-        // must free up the space used to track processes done
-        free(processes_completed);
+        printoutpercentiles(&stats);
     }
-    
-    // schedule tasks for the processes that are assigned
-    for (int t = 0; t < nprocessor; t++)
+    if (options->comparesplits)
     {
-        if (queue_size(readyqueue[t]) > 0)
-        {
-            // if the popped up process is different to the running one in cpu
-            // must use the head as cpu has one element inserted
-            if((queue_size(cpu[t])== 1) && (cpu[t]->items->head->data.remainingtime != readyqueue[t]->items->head->data.remainingtime) && (cpu[t]->items->head->data.processid != readyqueue[t]->items->head->data.processid))
-            {
-                queue_enqueue(cpu[t], readyqueue[t]->items->head->data);
-                print_running(time, cpu[t]->items->tail->data.processid, cpu[t]->items->tail->data.remainingtime, t, cpu[t]->items->tail->data.parallelisable);
-            }
-            // must use the head as cpu has more than one element inserted
-            else if ((queue_size(cpu[t])> 1) && (cpu[t]->items->tail->data.remainingtime != readyqueue[t]->items->head->data.remainingtime) && (cpu[t]->items->tail->data.processid != readyqueue[t]->items->head->data.processid))
-            {
-                queue_enqueue(cpu[t], readyqueue[t]->items->head->data);
-                print_running(time, cpu[t]->items->tail->data.processid, cpu[t]->items->tail->data.remainingtime, t, cpu[t]->items->tail->data.parallelisable);
-            }
-        }
+        compare_splits(trace, nprocessor, policy, split, options->gang, options->stealing);
     }
-    return cpu;
-}
-
-/* Fills in  a readyqueue and the assigns a process to cpu if empty or if 
-   the process has lesser remaining time than the existing process running 
-   in the cpu. 
-   The cpu is then returned. */
-Queue **store_assign_task(Queue *cpu[], Queue *readyqueue[], int time, int nprocessor, Data newdata)
-{
-    // find the least remaining time (readqueue id correspondence to 
-    // cpu id preferred over similar remaining time)
-    int index = find_cpu(nprocessor, readyqueue);
-
-    // if readyqueue is empty, fill and schedule the process
-    if (queue_size(readyqueue[index]) == 0)
+    if (options->comparegang)
     {
-        queue_enqueue(readyqueue[index], newdata);
-        cpu = schedule_cpu(cpu, readyqueue[index]->items->head->data, time, index);
-    }
-    else
-    { 
-        // if readyqueue is already filled then track previous data value, sort
-        // compare with the enqueued node on the readyqueue
-        Data prevdata = readyqueue[index]->items->head->data;
-        queue_enqueue(readyqueue[index], newdata);
-        bubbleSort(readyqueue[index]);
-
-        // a lesser remaining time process with different pid is allowed for a switch on the cpu
-        if (prevdata.remainingtime != readyqueue[index]->items->head->data.remainingtime &&prevdata.processid != readyqueue[index]->items->head->data.processid)
-        {
-            cpu = schedule_cpu(cpu, readyqueue[index]->items->head->data, time, index);
-        }
+        compare_gang(trace, nprocessor, policy, split, options->stealing);
     }
-    return cpu;
 }
 
-/* No process exchange occurs on the ongoing cpu from the readyqueue.The processes
-   continue till it gets exhausted (it's remaining time becomes zero for a particular process).
-   Returns the cpu once an update at either readyqueue or cpu(scheduled a task). */
-Queue **fcfs(Queue *cpu[], Queue *readyqueue[], int time, int totalexecutiontime, int *nprocessor, int arrivaltime[], int executiontime[], int completiontime[], int turnaroundtime[], double timeoverhead[], CompressedData *process_done)
+/* Plans the trace for the least makespan instead of simulating a policy:
+   longest processing time first placement, improved by local search, each
+   cpu running what it is given in order of arrival. Given a budget by the
+   options, the plan is then searched from for the least makespan on their
+   number of threads. Prints every event unless quiet, then the statistics
+   and how far they are at most from the best possible. */
+void plan_challenge(Trace *trace, const Options *options)
 {
-    int process_pop = 0;
+    Stats stats;
+    int nprocessor = options->nprocessor;
+    long long budgetns = options->budgetns;
+    Output *output = options->quiet ? NULL : new_output(stdout); // the running and finished lines
 
-    // simulatenously decrease all remaining time of the cpus
-    for (int i = 0; i < *nprocessor; i++)
-    {
-        if (queue_size(readyqueue[i]) > 0)
-        {
-            readyqueue[i]->items->head->data.remainingtime -= 1;
-        }
-    }
-    
-    // check for when the processes finish and collect them, handy for collecting all 
-    // simultaneous finishes
-    Data* processes_completed = NULL;
-    int insertion = 0;
-    for (int i = 0; i < *nprocessor; i++)
-    {
-        if(queue_size(readyqueue[i])!=0)
-        {
-            if(readyqueue[i]->items->head->data.remainingtime == 0)
-            {
-                Data finisheddata = queue_dequeue(readyqueue[i]);
-                // allocate fresh memories to collect completed processes
-                processes_completed = realloc(processes_completed, sizeof(Data)*(insertion+1));
-                processes_completed[insertion] = finisheddata;
-                // know how much finished for later looping
-                insertion++;
-                // flag to indicate processes finished
-                process_pop = 1;
-            }
-        }
-    }
+    Plan *plan = new_plan(trace, nprocessor);
+    plan_improve(plan, PLAN_SEARCH_BUDGET);
+    long long nodes = 0;
+    int proven = (budgetns > 0) ? optimise_plan(plan, options->nthreads, budgetns, &nodes) : 0;
+    plan_run(plan, output ? print_event : NULL, output, &stats);
+    free_plan(plan);
 
-    // check if there are processes finished, then collect stats and print
-    if(process_pop==1)
+    if (output != NULL)
     {
-        // calculate, store and mark of processes done
-        for(int u= 0; u < insertion;u++)
-        {
-            finished_process(readyqueue, *nprocessor, arrivaltime, executiontime, completiontime, turnaroundtime, timeoverhead, time, process_done, processes_completed[u]);
-        }
-        // must free up the space used to track processes done
-        free(processes_completed);
+        free_output(output);
     }
-    
-    // if all processes finish - safe exit
-    if (allemptyqueue(readyqueue, *nprocessor))
+    Bounds bounds;
+    Split split = all_split();
+    compute_bounds(trace, nprocessor, &split, &bounds);
+    printoutstats(&stats, &bounds);
+    if (options->percentiles)
     {
-        return cpu;
+        printoutpercentiles(&stats);
     }
-    
-    // schedule tasks for the processes that are assigned 
-    for (int i = 0; i < *nprocessor; i++)
+    if (budgetns > 0)
     {
-        if(queue_size(readyqueue[i]) > 0)
-        {
-            // if the popped up process is different to the running one in cpu
-            if(cpu[i]->items->tail->data.processid!=readyqueue[i]->items->head->data.processid)
-            {
-               cpu = schedule_cpu(cpu, readyqueue[i]->items->head->data, time, i); 
-            }
-        }
+        printf("Searched %lld nodes, makespan %s\n", nodes, proven ? "proven optimal" : "best found in budget");
     }
-    return cpu;
 }
 
-/* This program handles the scenario when multiple process arrives from the readinqueue at 
-   the same particular time. The processes are collected at the empty least remaining time 
-   readyqueue corresponding to the equivalent cpu. For a multiprocessor, it goes to the 
-   least remaining time readyqueue which corresponds to an equivalent least remaining time cpu.
-   Returns the queued in cpu from the readyqueue. */
-Queue **multiarrival(Queue *readinqueue, int time, Queue *readyqueue[], Queue *cpu[], int *nprocessor, int arrivaltime[], int executiontime[], int completiontime[], int turnaroundtime[], double timeoverhead[], int multi, CompressedData *process_done)
+/* Runs the trace for real on nprocessor pinned worker threads, a unit of
+   time taking unitus microseconds, and prints the measured makespan next
+   to the simulated one. */
+void execute(Trace *trace, int nprocessor, long long unitus)
 {
-    
-    int insertion = 0;
-    while (time == readinqueue->items->head->data.arrivaltime)
+    // the workers schedule shortest remaining time first
+    Stats stats;
+    Policy policy = srtf_policy();
+    Split split = all_split();
+    simulate(trace, nprocessor, &policy, &split, 0, 0, NULL, NULL, NULL, &stats);
+
+    // the clock cannot wait out arrivals past the range of a long long
+    Process *last = (trace->count > 0) ? trace_peek(trace, trace->count - 1) : NULL;
+    if (unitus > LLONG_MAX / NS_PER_US ||
+        (last != NULL && last->arrivaltime > executor_max_arrival(unitus * NS_PER_US)))
     {
-        if (readinqueue->items->head->data.parallelisable == 'n')
-        {
-            // remove the non parallel process from readinqueue
-            // find the cpu and then insert into the readyqueue
-            Data newdata = queue_dequeue(readinqueue);
-            int index = find_cpu(*nprocessor, readyqueue);
-            queue_enqueue(readyqueue[index], newdata);
-            insertion++;
-        }
-        else if (readinqueue->items->head->data.parallelisable == 'p')
-        {
-            // allocate the array to copy to readyqueue
-            Data *dataarray = malloc(sizeof(Data) * (*nprocessor));
-            // remove each parallelised (thread) process,convert to subprocess
-            // and then insert  into the readyqueue 
-            Data newdata = queue_dequeue(readinqueue);
-            dataarray = create_subprocess(dataarray, newdata, *nprocessor);
-            for (int i = 0; i < *nprocessor; i++)
-            {
-                int index = find_cpu(*nprocessor, readyqueue);
-                queue_enqueue(readyqueue[index], dataarray[i]);
-                insertion++;
-            }
-            free(dataarray);
-        }
-        // stop collecting when all processes are in readyqueue
-        if (queue_size(readinqueue) == 0)
-        {
-            break;
-        }
-    }
-    
-    for (int i = 0; i < *nprocessor; i++)
-    { 
-        // assign to any empty queue - all empty queues state here
-        if(queue_size(cpu[i])==0)
-        {
-                cpu = schedule_cpu(cpu, readyqueue[i]->items->head->data, time,i);
-        }
-        else if (queue_size(cpu[i])==1)
-        {
-             // assign to any empty queue - atleast one filled empty queue state here
-            if((cpu[i]->items->head->data.remainingtime != readyqueue[i]->items->head->data.remainingtime) && (cpu[i]->items->head->data.processid != readyqueue[i]->items->head->data.processid))
-            {
-                cpu = schedule_cpu(cpu, readyqueue[i]->items->head->data, time,i);
-            }
-        }
-        else if (queue_size(cpu[i])>1)
-        {
-            // assign when all are assigned some process before   
-            if((cpu[i]->items->tail->data.remainingtime != readyqueue[i]->items->head->data.remainingtime) && (cpu[i]->items->tail->data.processid != readyqueue[i]->items->head->data.processid)){
-                cpu = schedule_cpu(cpu, readyqueue[i]->items->head->data, time,i);
-            }
-        }
+        fprintf(stderr, "Usage : --unit %lld is too long to wait for arrivals as late as the trace's on the clock\n", unitus);
+        exit(EXIT_FAILURE);
     }
 
-    return cpu;
+    Executor *executor = new_executor(nprocessor, unitus * NS_PER_US);
+    long long makespan = executor_run(executor, trace);
+    free_executor(executor);
+
+    printf("Simulated makespan %lld\n", stats.makespan);
+    printf("Measured makespan %.2f (%.3fs at %lldus per unit)\n", (double)makespan / (unitus * NS_PER_US), (double)makespan / (1000 * 1000 * 1000), unitus);
 }
 
-/* This program handles the scenario when a single process arrives from the readinqueue.
-   The processes go to the readyqueue corresponding to the equivalent cpu.
-   For a multiprocessor, it goes to the least remaining time readyqueue which corresponds to
-   an equivalent least remaining time cpu.
-   Returns the queued in cpu from the readyqueue. */
-Queue **singlearrival(Queue *readinqueue, int time, Queue *readyqueue[], Queue *cpu[], int *nprocessor, int arrivaltime[], int executiontime[], int completiontime[], int turnaroundtime[], double timeoverhead[], CompressedData *process_done)
+/* Prints out a run of a sweep as a row of the same statistics
+   printoutstats gives for a single run. */
+void printoutsweeprow(SweepRun *run)
 {
-    // remove a node 
-    Data newdata = queue_dequeue(readinqueue);
-    
-    // after time > 0 some processes are running, update both readyqueue and cpu
-    if (time > 0)
-    {
-        cpu = update_readyqueue_cpu(readyqueue, cpu, *nprocessor, arrivaltime, executiontime, completiontime, turnaroundtime, timeoverhead, time, process_done);
-    }
-    // delegate task and store and assign each process from readyqueue to cpu
-    if (newdata.parallelisable == 'n')
-    {
-        cpu = store_assign_task(cpu, readyqueue, time, *nprocessor, newdata);
-    }
-    else if (newdata.parallelisable == 'p')
-    {
-        // store, delegate and assign cpu by creating, copying subprocesses onto an array
-        // free memory once completed 
-        Data *dataarray = malloc(sizeof(Data) * (*nprocessor));
-        dataarray = create_subprocess(dataarray, newdata, *nprocessor);
+    Stats *stats = &run->stats;
+    double maxturnaroundtime = roundupdouble(stats->maxtimeoverhead);
 
-        for (int i = 0; i < *nprocessor; i++)
-        {
-            cpu = store_assign_task(cpu, readyqueue, time, *nprocessor, dataarray[i]);
-        }
-        free(dataarray);
-    }
-    return cpu;
+    printf("%s,%d,%d,%lld,%.2f,%.2f,%lld\n", run->filepath, run->nprocessor, run->challenge,
+        (long long)ceil(stats_average_turnaround(stats)), maxturnaroundtime,
+        stats_average_overhead(stats), stats->makespan);
 }
 
-/* Shortest remaining time first algorithm implementation done here.
-   With progress of time, it stores the processes in a ready queue
-   and whenever any incoming process finds a spot, it overtakes the cpu.
-   Later the statistics of the simulation printed out. */
-void strf(int *nprocessor, Queue *readinqueue, int totalexecutiontime, int count)
+/* Runs every configuration of a sweep the options give and prints a row of
+   statistics for each. Each file is read in once, then shared between all
+   the runs on it. */
+void sweep(const Options *options)
 {
-    // strf implementation starts here
-    int time = 0;
-    int multi = 0;
-    int arrivaltime[count];
-    int executiontime[count];
-    int completiontime[count];
-    int turnaroundtime[count];
-    double timeoverhead[count];
-    Queue **readyqueue = malloc(sizeof(Queue*) * (*nprocessor));
-    Queue **cpu = malloc(sizeof(Queue*) * (*nprocessor));
-    int maxpid = find_max_pid(readinqueue);
-    CompressedData *process_done = malloc(sizeof(CompressedData) * (maxpid+1));
-   
-    // assign the relevant temporary arrays
-    initialise_arrays(arrivaltime, executiontime, completiontime, turnaroundtime,timeoverhead, count);
-    
-    // initialise the handy process done to keep track of subprocesses
-    initialise_process_done(process_done,maxpid+1);
-
-     // generate processors as requested
-    for (int i = 0; i < (*nprocessor); i++)
-    {
-        cpu[i] = new_queue();
-        readyqueue[i] = new_queue();
-    }
-
-    // preprocessing phase
-    if (readinqueue->items->head->data.arrivaltime == readinqueue->items->head->next->data.arrivaltime)
-    {
-        bubbleSort(readinqueue);
-        multi = 1;
+    int from = options->from;
+    int to = options->to;
+    int nfiles = options->nfiles;
+    char **filepaths = options->filepaths;
+
+    // read each trace in once
+    int nvariants = options->challenge ? 2 : 1;
+    Trace **traces = malloc(sizeof(Trace *) * nfiles);
+    for (int f = 0; f < nfiles; f++)
+    {
+        traces[f] = readfile(filepaths[f], 0, 0);
+        // a mapped trace gathers processes into one slot, so cannot be shared
+        trace_materialise(traces[f]);
+    }
+
+    // one run per variant, trace and number of processors, in that order,
+    // so the simulated runs and the planned ones each lie together
+    int nprocessors = to - from + 1;
+    int nvariantruns = nfiles * nprocessors;
+    int nruns = nvariants * nvariantruns;
+    SweepRun *runs = malloc(sizeof(SweepRun) * nruns);
+    assert(runs);
+    int r = 0;
+    for (int v = 0; v < nvariants; v++)
+    {
+        for (int f = 0; f < nfiles; f++)
+        {
+            for (int p = from; p <= to; p++)
+            {
+                runs[r].trace = traces[f];
+                runs[r].filepath = filepaths[f];
+                runs[r].nprocessor = p;
+                runs[r].challenge = v;
+                r++;
+            }
+        }
     }
 
-    // Main brain of the strf algorithm.
-    // The readinqueue must have read some input or the readyqueue must have gone through
-    // all the assignments to the cpu.
-    while (queue_size(readinqueue) > 0 || !(allemptyqueue(readyqueue, *nprocessor)))
+    run_sweep(runs, nvariantruns, options->nthreads, simulate_quietly);
+    if (options->challenge)
     {
-        // check if the processes arent assigned
-        if (queue_size(readinqueue) > 0)
+        run_sweep(runs + nvariantruns, nvariantruns, options->nthreads, plan_quietly);
+    }
+
+    // rows go by trace, then variant, then number of processors
+    printf("trace,processors,challenge,turnaround,maxoverhead,avgoverhead,makespan\n");
+    for (int f = 0; f < nfiles; f++)
+    {
+        for (int v = 0; v < nvariants; v++)
         {
-            // assign upon arrival
-            if (time == readinqueue->items->head->data.arrivaltime)
-            {
-                // if readinqueue has atleast two elements
-                if (readinqueue->items->head->next != NULL)
-                {
-                    // atleast 2 consecutive processes have the same arrival time
-                    if (time == readinqueue->items->head->data.arrivaltime && time == readinqueue->items->head->next->data.arrivaltime && multi == 1)
-                    {
-                        cpu = multiarrival(readinqueue, time, readyqueue, cpu, nprocessor, arrivaltime, executiontime, completiontime, turnaroundtime, timeoverhead, multi, process_done);
-                    }
-                    else  if (time == readinqueue->items->head->data.arrivaltime && time != readinqueue->items->head->next->data.arrivaltime)
-                    { 
-                        // one process arrives while the other is on its way
-                        cpu = singlearrival(readinqueue, time, readyqueue, cpu, nprocessor, arrivaltime, executiontime, completiontime, turnaroundtime, timeoverhead, process_done);
-                    }
-                }
-                else
-                {  
-                    // just one process left in readyqueue to assign to cpu
-                    cpu = singlearrival(readinqueue, time, readyqueue, cpu, nprocessor, arrivaltime, executiontime, completiontime, turnaroundtime, timeoverhead, process_done);
-                }
-            }
-            else 
+            for (int p = 0; p < nprocessors; p++)
             {
-                // update on the running processes
-                cpu = update_readyqueue_cpu(readyqueue, cpu, *nprocessor, arrivaltime, executiontime, completiontime, turnaroundtime, timeoverhead, time, process_done);
+                printoutsweeprow(&runs[v * nvariantruns + f * nprocessors + p]);
             }
         }
-        else if (queue_size(readinqueue) == 0)
-        {
-            // all processes are assign and it then goes through a simple fcfs
-            cpu = fcfs(cpu, readyqueue, time, totalexecutiontime, nprocessor, arrivaltime, executiontime, completiontime, turnaroundtime, timeoverhead, process_done);
-        }
-        // update time when all steps passed
-        time++;
-    }
-
-    // all necessary statistics are calculated
-    printoutstats(count, *nprocessor, turnaroundtime, timeoverhead, time - 1);
-
-    // free up memory
-    free_queue(readinqueue);
-    
-     for (int i = 0; i < (*nprocessor); i++)
-     {
-         free_queue(cpu[i]);
-         free_queue(readyqueue[i]);
-     }
-    free(readyqueue);
-    free(cpu);
-    free(process_done);
+    }
+
+    for (int f = 0; f < nfiles; f++)
+    {
+        free_trace(traces[f]);
+    }
+    free(traces);
+    free(runs);
 }
 
 /* Control centre of the program that delegates tasks to relevant functions.
@@ -991,21 +563,50 @@ void strf(int *nprocessor, Queue *readinqueue, int totalexecutiontime, int count
 int main(int argc, char *argv[])
 {
     /* Variables declared */
-    char *filepath = NULL;
-    int nprocessor = 0;
-    int count = 0;
-    int totalexecutiontime = 0;
-    int challenge = 0;
-    Queue *readinqueue = NULL;
+    Options *options = NULL;
+    Trace *trace = NULL;
+
+    // './allocate --convert in.txt out.bin' only rewrites the trace
+    if (argc == CONVERTSTDIN && strcmp(argv[1], CONVERT) == 0)
+    {
+        convert_trace(argv[2], argv[3]);
+        return 0;
+    }
 
     // read from the stdin
-    filepath = readfromstdin(argc, argv, &nprocessor, filepath, &challenge);
+    options = new_options(argc, argv);
 
-    // read the file on to a queue
-    readinqueue = readfile(filepath, readinqueue, &totalexecutiontime, &count, challenge);
+    // './allocate --sweep ...' runs many configurations at once
+    if (options->sweep)
+    {
+        sweep(options);
+        free_options(options);
+        return 0;
+    }
+
+    // read the file on to a trace, all of it to run for real
+    trace = readfile(options->filepath, options->challenge || options->gap || options->comparesplits || options->comparegang,
+        options->stream && options->unitus == 0);
+
+    if (options->unitus > 0)
+    {
+        execute(trace, options->nprocessor, options->unitus);
+        free_trace(trace);
+        free_options(options);
+        return 0;
+    }
 
-    // create a function for strf here
-    strf(&nprocessor, readinqueue, totalexecutiontime, count);
+    // create a function for strf here, unless planning for the challenge
+    if (options->challenge == 1)
+    {
+        plan_challenge(trace, options);
+    }
+    else
+    {
+        strf(trace, options);
+    }
+    free_trace(trace);
+    free_options(options);
 
     return 0;
-}
\ No newline at end of file
+}
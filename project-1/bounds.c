@@ -0,0 +1,144 @@
+/* * * * * * * *  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Description : Module for lower bounds on how well any schedule of a      *
+ *               trace can do, to tell how far a run is from the best       *
+ * Layout by :  Matt Farrugia <matt.farrugia@unimelb.edu.au>                *
+ * Created by :Syed Ahammad Newaz Saif                                      *
+ * Email : snewaz@student.unimelb.edu.au                                    *
+ * Student ID : 684933                                                      *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * * */
+
+/* List of libraries for the assignment */
+#include <stdlib.h>
+#include <assert.h>
+#include "data.h"
+#include "heap.h"
+#include "bounds.h"
+
+/* Helper function that orders data by arrival time, kept in sequence. */
+int compare_arrival_data(const void *a, const void *b);
+
+/* * * * * * * * * * * * *
+ * FUNCTION DEFINITIONS  *
+ * * * * * * * * * * * * */
+
+/* Helper function that orders data by arrival time, kept in sequence. */
+int compare_arrival_data(const void *a, const void *b)
+{
+    const Data *first = a;
+    const Data *second = b;
+    return (first->sequence > second->sequence) - (first->sequence < second->sequence);
+}
+
+/* Works out lower bounds for every process of trace on nprocessor cpus,
+   parallelisable processes split as split chooses.
+   The makespan is at least
+   - the latest any process can finish, its arrival time plus the time it
+     takes on a cpu (a subprocess's time if it is parallelisable), and
+   - for each arrival time, that time plus the work arriving from then on
+     shared between the cpus, the best one cpu nprocessor times as fast
+     could do with preemption (total work / nprocessor the first of them).
+   The total turnaround time is at least the larger of the time every
+   process takes on a cpu and the total that one cpu nprocessor times as
+   fast gets running shortest remaining work first, which is the best it
+   can do. A split depending on the load is taken at its best for each: the
+   shortest subprocesses and the least work. O(n log n). */
+void compute_bounds(Trace *trace, int nprocessor, const Split *split, Bounds *bounds)
+{
+    assert(trace != NULL && trace->file == NULL && nprocessor >= 1 && split != NULL && bounds != NULL);
+    int count = trace->count;
+    bounds->makespan = 0;
+    bounds->turnaroundtime = 0;
+    if (count == 0)
+    {
+        return;
+    }
+
+    // each process as its work in remainingtime and its arrival in sequence
+    Data *work = malloc(sizeof(Data) * count);
+    assert(work);
+    double totallength = 0;
+    for (int i = 0; i < count; i++)
+    {
+        Process *process = trace_peek(trace, i);
+        // a subprocess is the least time a parallelisable process takes
+        long long length = process->executiontime;
+        long long total = process->executiontime;
+        if (process->parallelisable == 'p' && split->adaptive)
+        {
+            // as many subprocesses as cpus are the shortest, one the least work
+            length = subprocess_time(process->executiontime, nprocessor);
+            total = subprocess_time(process->executiontime, 1);
+        }
+        else if (process->parallelisable == 'p')
+        {
+            int k = split->factor(split, process->executiontime, nprocessor, NULL);
+            length = subprocess_time(process->executiontime, k);
+            total = length * k;
+        }
+        if (process->arrivaltime + length > bounds->makespan)
+        {
+            bounds->makespan = process->arrivaltime + length;
+        }
+        totallength += length;
+
+        work[i].remainingtime = total;
+        work[i].sequence = process->arrivaltime;
+        work[i].used = 0;
+        work[i].level = 0;
+        work[i].process = i;
+        work[i].processid = process->processid;
+        work[i].child = 0;
+        work[i].parallelisable = process->parallelisable;
+    }
+    qsort(work, count, sizeof(Data), compare_arrival_data);
+
+    // the work arriving from each arrival time on, latest first
+    long long later = 0;
+    for (int i = count - 1; i >= 0; i--)
+    {
+        later += work[i].remainingtime;
+        // rounded up, processes only finish at whole times
+        long long shared = work[i].sequence + (later + nprocessor - 1) / nprocessor;
+        if (shared > bounds->makespan)
+        {
+            bounds->makespan = shared;
+        }
+    }
+
+    // run the fast cpu in time scaled by nprocessor, so it does a unit of
+    // work in each unit of scaled time
+    Heap *readyqueue = new_heap();
+    long long time = 0;
+    double totalturnaround = 0;
+    int next = 0;
+    while (next < count || heap_size(readyqueue) > 0)
+    {
+        if (heap_size(readyqueue) == 0 && work[next].sequence * nprocessor > time)
+        {
+            time = work[next].sequence * nprocessor;
+        }
+        while (next < count && work[next].sequence * nprocessor <= time)
+        {
+            heap_insert(readyqueue, work[next]);
+            next++;
+        }
+
+        // run the least remaining work until it finishes or the next arrival
+        Data *running = heap_peek_min(readyqueue);
+        if (next < count && work[next].sequence * nprocessor < time + running->remainingtime)
+        {
+            running->remainingtime -= work[next].sequence * nprocessor - time;
+            time = work[next].sequence * nprocessor;
+        }
+        else
+        {
+            time += running->remainingtime;
+            totalturnaround += (double)(time - running->sequence * nprocessor) / nprocessor;
+            heap_remove_min(readyqueue);
+        }
+    }
+    free_heap(readyqueue);
+    free(work);
+
+    bounds->turnaroundtime = ((totalturnaround > totallength) ? totalturnaround : totallength) / count;
+}
@@ -0,0 +1,53 @@
+/* * * * * * * *  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Description : Module for lower bounds on how well any schedule of a      *
+ *               trace can do, to tell how far a run is from the best       *
+ * Layout by :  Matt Farrugia <matt.farrugia@unimelb.edu.au>                *
+ * Created by :Syed Ahammad Newaz Saif                                      *
+ * Email : snewaz@student.unimelb.edu.au                                    *
+ * Student ID : 684933                                                      *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * * */
+
+#ifndef BOUNDS_H
+#define BOUNDS_H
+
+#include "trace.h"
+#include "split.h"
+
+/* * * * * * * * * * *
+ * TYPE DEFINITIONS  *
+ * * * * * * * * * * */
+
+typedef struct bounds Bounds;
+
+/* * * * * * * * * *
+ * DATA STRUCTURES *
+ * * * * * * * * * */
+
+/* No schedule of the trace on the same cpus, splitting parallelisable
+   processes as the simulator does, does better than these. */
+struct bounds
+{
+    long long makespan;
+    double turnaroundtime;  // average over the processes
+};
+
+/* * * * * * * * * * * * *
+ * FUNCTION DEFINITIONS  *
+ * * * * * * * * * * * * */
+
+/* Works out lower bounds for every process of trace on nprocessor cpus,
+   parallelisable processes split as split chooses.
+   The makespan is at least
+   - the latest any process can finish, its arrival time plus the time it
+     takes on a cpu (a subprocess's time if it is parallelisable), and
+   - for each arrival time, that time plus the work arriving from then on
+     shared between the cpus, the best one cpu nprocessor times as fast
+     could do with preemption (total work / nprocessor the first of them).
+   The total turnaround time is at least the larger of the time every
+   process takes on a cpu and the total that one cpu nprocessor times as
+   fast gets running shortest remaining work first, which is the best it
+   can do. A split depending on the load is taken at its best for each: the
+   shortest subprocesses and the least work. O(n log n). */
+void compute_bounds(Trace *trace, int nprocessor, const Split *split, Bounds *bounds);
+
+#endif
@@ -0,0 +1,28 @@
+/* * * * * * * *  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Description : Module for the hot record of a process or subprocess, the  *
+ *               part the scheduler moves between readyqueues and cpus      *
+ * Layout by :  Matt Farrugia <matt.farrugia@unimelb.edu.au>                *
+ * Created by :Syed Ahammad Newaz Saif                                      *
+ * Email : snewaz@student.unimelb.edu.au                                    *
+ * Student ID : 684933                                                      *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * * */
+
+/* List of libraries for the assignment */
+#include "data.h"
+
+/* Returns whether a comes before b by id: by processid, then by which
+   subprocess it is. */
+bool processid_before(const Data *a, const Data *b)
+{
+    if (a->processid != b->processid)
+    {
+        return a->processid < b->processid;
+    }
+    return a->child < b->child;
+}
+
+/* Returns whether a and b are the same process or subprocess. */
+bool same_processid(const Data *a, const Data *b)
+{
+    return a->processid == b->processid && a->child == b->child;
+}
@@ -0,0 +1,50 @@
+/* * * * * * * *  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Description : Module for the hot record of a process or subprocess, the  *
+ *               part the scheduler moves between readyqueues and cpus      *
+ * Layout by :  Matt Farrugia <matt.farrugia@unimelb.edu.au>                *
+ * Created by :Syed Ahammad Newaz Saif                                      *
+ * Email : snewaz@student.unimelb.edu.au                                    *
+ * Student ID : 684933                                                      *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * * */
+
+#ifndef DATA_H
+#define DATA_H
+#include <stdbool.h>
+
+/* * * * * * * * * * *
+ * TYPE DEFINITIONS  *
+ * * * * * * * * * * */
+
+typedef struct data Data;
+
+/* * * * * * * * * *
+ * DATA STRUCTURES *
+ * * * * * * * * * */
+
+/* The hot record of a process or subprocess, the only part the scheduler
+   touches while sorting, placing and ticking. Everything read in about the
+   process lives in its cold Process record, found through its handle. */
+struct data
+{
+    long long remainingtime;
+    long long sequence; // when it joined a readyqueue, for policies going by it
+    long long used;     // time run on its current quantum
+    int level;          // queue level, for the multilevel feedback queue
+    int process; // slot of the (parent) process in the table in flight
+    char parallelisable;
+    int processid;      // of the process, or of the parent of a subprocess
+    int child;          // which subprocess it is, 0 for a whole process
+};
+
+/* * * * * * * * * * * * *
+ * FUNCTION DEFINITIONS  *
+ * * * * * * * * * * * * */
+
+/* Returns whether a comes before b by id: by processid, then by which
+   subprocess it is. */
+bool processid_before(const Data *a, const Data *b);
+
+/* Returns whether a and b are the same process or subprocess. */
+bool same_processid(const Data *a, const Data *b);
+
+#endif
@@ -0,0 +1,407 @@
+/* * * * * * * *  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Description : Module for running a trace for real, as busy work on one   *
+ *               pinned thread per cpu scheduled shortest remaining time    *
+ *               first, to check the simulation against the machine        *
+ * Layout by :  Matt Farrugia <matt.farrugia@unimelb.edu.au>                *
+ * Created by :Syed Ahammad Newaz Saif                                      *
+ * Email : snewaz@student.unimelb.edu.au                                    *
+ * Student ID : 684933                                                      *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * * */
+
+/* pinning threads to cpus is a GNU extension */
+#define _GNU_SOURCE
+
+/* List of libraries for the assignment */
+#include <stdlib.h>
+#include <assert.h>
+#include <errno.h>
+#include <limits.h>
+#include <time.h>
+#include <sched.h>
+#include <unistd.h>
+#include "executor.h"
+#include "sched.h"
+
+/* Nanoseconds of busy work timed to measure how much fits in a unit. */
+#define CALIBRATION_NS 20000000LL
+#define NS_PER_SECOND 1000000000LL
+
+/* Helper function that returns the monotonic clock in nanoseconds. */
+long long now_ns();
+
+/* Helper function that burns through spins iterations of arithmetic. */
+void busy_work(long long spins);
+
+/* Helper function that hands a process or subprocess to a worker's inbox,
+   sleeping while the inbox is full, and wakes the worker. */
+void inbox_push(Inbox *inbox, Data data);
+
+/* Helper function that takes the oldest item in a worker's inbox.
+   Returns 1 if there was one, 0 if the inbox is empty. */
+int inbox_pop(Inbox *inbox, Data *data);
+
+/* Helper function that sleeps until a worker's inbox has an item in it or
+   every process has been handed out. */
+void inbox_wait(Inbox *inbox, Executor *executor);
+
+/* Helper function that places work on the worker with the least work
+   outstanding, lowest cpu on a tie, as the simulator places by default. */
+void place_work(Executor *executor, Data data);
+
+/* Helper function that each worker thread runs. */
+void *worker_main(void *argument);
+
+/* * * * * * * * * * * * *
+ * FUNCTION DEFINITIONS  *
+ * * * * * * * * * * * * */
+
+/* Helper function that returns the monotonic clock in nanoseconds. */
+long long now_ns()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (long long)now.tv_sec * NS_PER_SECOND + now.tv_nsec;
+}
+
+/* Helper function that burns through spins iterations of arithmetic. */
+void busy_work(long long spins)
+{
+    // volatile so the loop is not optimised away
+    volatile unsigned long long sink = 1;
+    for (long long i = 0; i < spins; i++)
+    {
+        sink = sink * 6364136223846793005ULL + 1442695040888963407ULL;
+    }
+}
+
+/* Creates an executor of nprocessor workers, a unit of execution time taking
+   unitns nanoseconds. Measures how much busy work that is on this machine.
+   Returns a pointer to it. */
+Executor *new_executor(int nprocessor, long long unitns)
+{
+    assert(nprocessor >= 1 && unitns >= 1);
+    Executor *executor = malloc(sizeof *executor);
+    assert(executor);
+
+    executor->nprocessor = nprocessor;
+    executor->unitns = unitns;
+    executor->workers = malloc(sizeof(Worker) * nprocessor);
+    assert(executor->workers);
+    executor->load = new_loadtree(nprocessor);
+    executor->trace = NULL;
+    executor->children = NULL;
+    executor->completions = NULL;
+    executor->start = 0;
+    atomic_init(&executor->done, 0);
+
+    // double the work until it takes long enough to time reliably
+    long long spins = 1024;
+    long long elapsed = 0;
+    while (elapsed < CALIBRATION_NS)
+    {
+        spins *= 2;
+        long long before = now_ns();
+        busy_work(spins);
+        elapsed = now_ns() - before;
+    }
+    executor->spinsperunit = (long long)((double)spins / elapsed * unitns);
+    if (executor->spinsperunit < 1)
+    {
+        executor->spinsperunit = 1;
+    }
+
+    return executor;
+}
+
+/* Destroys an executor and its associated memory. */
+void free_executor(Executor *executor)
+{
+    assert(executor != NULL);
+    free_loadtree(executor->load);
+    free(executor->workers);
+    free(executor);
+}
+
+/* Returns the latest arrival time a run can wait for on the clock, a unit
+   taking unitns nanoseconds. */
+long long executor_max_arrival(long long unitns)
+{
+    assert(unitns >= 1);
+    // half the range is left for the clock at the start
+    return (LLONG_MAX / 2) / unitns;
+}
+
+/* Helper function that hands a process or subprocess to a worker's inbox,
+   sleeping while the inbox is full, and wakes the worker. */
+void inbox_push(Inbox *inbox, Data data)
+{
+    long tail = atomic_load_explicit(&inbox->tail, memory_order_relaxed);
+    if (tail - atomic_load_explicit(&inbox->head, memory_order_acquire) == INBOX_CAPACITY)
+    {
+        // the worker takes items out under the lock before signalling
+        pthread_mutex_lock(&inbox->lock);
+        while (tail - atomic_load_explicit(&inbox->head, memory_order_acquire) == INBOX_CAPACITY)
+        {
+            pthread_cond_wait(&inbox->nonfull, &inbox->lock);
+        }
+        pthread_mutex_unlock(&inbox->lock);
+    }
+    inbox->items[tail & (INBOX_CAPACITY - 1)] = data;
+    // publish the item only once it is written
+    atomic_store_explicit(&inbox->tail, tail + 1, memory_order_release);
+
+    // a worker that found the inbox empty under the lock is asleep by now
+    pthread_mutex_lock(&inbox->lock);
+    pthread_cond_signal(&inbox->nonempty);
+    pthread_mutex_unlock(&inbox->lock);
+}
+
+/* Helper function that takes the oldest item in a worker's inbox.
+   Returns 1 if there was one, 0 if the inbox is empty. */
+int inbox_pop(Inbox *inbox, Data *data)
+{
+    long head = atomic_load_explicit(&inbox->head, memory_order_relaxed);
+    if (head == atomic_load_explicit(&inbox->tail, memory_order_acquire))
+    {
+        return 0;
+    }
+    *data = inbox->items[head & (INBOX_CAPACITY - 1)];
+    // free the place only once it is read
+    atomic_store_explicit(&inbox->head, head + 1, memory_order_release);
+    return 1;
+}
+
+/* Helper function that sleeps until a worker's inbox has an item in it or
+   every process has been handed out. */
+void inbox_wait(Inbox *inbox, Executor *executor)
+{
+    pthread_mutex_lock(&inbox->lock);
+    while (atomic_load_explicit(&inbox->head, memory_order_relaxed) == atomic_load_explicit(&inbox->tail, memory_order_acquire) &&
+        !atomic_load(&executor->done))
+    {
+        pthread_cond_wait(&inbox->nonempty, &inbox->lock);
+    }
+    pthread_mutex_unlock(&inbox->lock);
+}
+
+/* Helper function that places work on the worker with the least work
+   outstanding, lowest cpu on a tie, as the simulator places by default. */
+void place_work(Executor *executor, Data data)
+{
+    // the root of the tree is the worker, as in the simulator
+    int index = loadtree_min(executor->load);
+    loadtree_add(executor->load, index, data.remainingtime);
+    inbox_push(&executor->workers[index].inbox, data);
+}
+
+/* Helper function that each worker thread runs. */
+void *worker_main(void *argument)
+{
+    Worker *worker = argument;
+    Executor *executor = worker->executor;
+
+#ifdef __linux__
+    // stay on one core so the cpus do not share one
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(worker->cpu % (cores > 0 ? cores : 1), &set);
+    pthread_setaffinity_np(pthread_self(), sizeof set, &set);
+#endif
+
+    while (1)
+    {
+        // take in newly placed work, a shorter process preempts from here
+        Data data;
+        int taken = 0;
+        while (inbox_pop(&worker->inbox, &data))
+        {
+            heap_insert(worker->readyqueue, data);
+            taken = 1;
+        }
+        if (taken)
+        {
+            // the dispatcher may be asleep on a full inbox
+            pthread_mutex_lock(&worker->inbox.lock);
+            pthread_cond_signal(&worker->inbox.nonfull);
+            pthread_mutex_unlock(&worker->inbox.lock);
+        }
+
+        if (heap_size(worker->readyqueue) == 0)
+        {
+            // read done before the inbox so nothing placed before it is missed
+            int finished = atomic_load(&executor->done);
+            if (inbox_pop(&worker->inbox, &data))
+            {
+                heap_insert(worker->readyqueue, data);
+            }
+            else if (finished)
+            {
+                return NULL;
+            }
+            else
+            {
+                // sleep rather than take a core from the workers with work
+                inbox_wait(&worker->inbox, executor);
+            }
+            continue;
+        }
+
+        // a unit of the process with the least remaining time
+        Data *running = heap_peek_min(worker->readyqueue);
+        busy_work(executor->spinsperunit);
+        running->remainingtime--;
+        atomic_fetch_add_explicit(&worker->worked, 1, memory_order_relaxed);
+
+        if (running->remainingtime == 0)
+        {
+            Data finished = heap_remove_min(worker->readyqueue);
+            // the last subprocess to finish finishes the process
+            if (atomic_fetch_sub(&executor->children[finished.process], 1) == 1)
+            {
+                atomic_store(&executor->completions[finished.process], now_ns() - executor->start);
+            }
+        }
+    }
+}
+
+/* Runs every process in the trace for real. Each arrives on the clock at
+   its arrival time and goes to the worker with the least work outstanding,
+   parallelisable processes split as the simulator splits them. Each worker
+   runs whatever it holds with the least remaining time, a unit at a time.
+   Returns the measured makespan in nanoseconds. */
+long long executor_run(Executor *executor, Trace *trace)
+{
+    assert(executor != NULL && trace != NULL && trace->file == NULL);
+    int nprocessor = executor->nprocessor;
+    executor->trace = trace;
+    free_loadtree(executor->load);
+    executor->load = new_loadtree(nprocessor);
+    executor->children = malloc(sizeof(atomic_int) * (trace->count + 1));
+    executor->completions = malloc(sizeof(atomic_llong) * (trace->count + 1));
+    assert(executor->children && executor->completions);
+    for (int i = 0; i < trace->count; i++)
+    {
+        atomic_init(&executor->children[i], 0);
+        atomic_init(&executor->completions[i], 0);
+    }
+    atomic_store(&executor->done, 0);
+
+    // the clock starts before any worker can finish anything
+    executor->start = now_ns();
+    for (int i = 0; i < nprocessor; i++)
+    {
+        Worker *worker = &executor->workers[i];
+        worker->cpu = i;
+        worker->executor = executor;
+        worker->readyqueue = new_heap();
+        atomic_init(&worker->inbox.head, 0);
+        atomic_init(&worker->inbox.tail, 0);
+        pthread_mutex_init(&worker->inbox.lock, NULL);
+        pthread_cond_init(&worker->inbox.nonempty, NULL);
+        pthread_cond_init(&worker->inbox.nonfull, NULL);
+        atomic_init(&worker->worked, 0);
+        worker->counted = 0;
+        int created = pthread_create(&worker->thread, NULL, worker_main, worker);
+        assert(created == 0);
+    }
+
+    // hand the processes out as the clock reaches them, everything due at
+    // once going shortest first like admit_arrivals
+    Heap *arrivals = new_heap();
+    Data *dataarray = malloc(sizeof(Data) * nprocessor);
+    int next = 0;
+    Process *process;
+    while ((process = trace_peek(trace, next)) != NULL)
+    {
+        long long arrivaltime = process->arrivaltime;
+        assert(arrivaltime <= executor_max_arrival(executor->unitns));
+        long long due = executor->start + arrivaltime * executor->unitns;
+        struct timespec wake = {due / NS_PER_SECOND, due % NS_PER_SECOND};
+        int slept;
+        while ((slept = clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wake, NULL)) == EINTR)
+        {
+            // woken early by a signal, sleep on
+        }
+        assert(slept == 0);
+
+        // take the work done since off the load of each worker
+        for (int i = 0; i < nprocessor; i++)
+        {
+            Worker *worker = &executor->workers[i];
+            long long worked = atomic_load_explicit(&worker->worked, memory_order_relaxed);
+            if (worked != worker->counted)
+            {
+                loadtree_add(executor->load, i, worker->counted - worked);
+                worker->counted = worked;
+            }
+        }
+
+        while ((process = trace_peek(trace, next)) != NULL && process->arrivaltime <= arrivaltime)
+        {
+            Data newdata = {0};
+            newdata.remainingtime = process->executiontime;
+            newdata.process = next;
+            newdata.processid = process->processid;
+            newdata.child = 0;
+            newdata.parallelisable = process->parallelisable;
+            heap_insert(arrivals, newdata);
+            next++;
+        }
+
+        while (heap_size(arrivals) > 0)
+        {
+            Data newdata = heap_remove_min(arrivals);
+            if (newdata.parallelisable == 'p')
+            {
+                atomic_store(&executor->children[newdata.process], nprocessor);
+                create_subprocess(dataarray, newdata, newdata.remainingtime, nprocessor);
+                for (int i = 0; i < nprocessor; i++)
+                {
+                    place_work(executor, dataarray[i]);
+                }
+            }
+            else
+            {
+                atomic_store(&executor->children[newdata.process], 1);
+                place_work(executor, newdata);
+            }
+        }
+    }
+    free(dataarray);
+    free_heap(arrivals);
+
+    // let the workers finish what they hold and leave, waking any asleep
+    atomic_store(&executor->done, 1);
+    for (int i = 0; i < nprocessor; i++)
+    {
+        Inbox *inbox = &executor->workers[i].inbox;
+        pthread_mutex_lock(&inbox->lock);
+        pthread_cond_signal(&inbox->nonempty);
+        pthread_mutex_unlock(&inbox->lock);
+    }
+    for (int i = 0; i < nprocessor; i++)
+    {
+        Inbox *inbox = &executor->workers[i].inbox;
+        pthread_join(executor->workers[i].thread, NULL);
+        free_heap(executor->workers[i].readyqueue);
+        pthread_mutex_destroy(&inbox->lock);
+        pthread_cond_destroy(&inbox->nonempty);
+        pthread_cond_destroy(&inbox->nonfull);
+    }
+
+    long long makespan = 0;
+    for (int i = 0; i < trace->count; i++)
+    {
+        long long completion = atomic_load(&executor->completions[i]);
+        if (completion > makespan)
+        {
+            makespan = completion;
+        }
+    }
+    free(executor->children);
+    free(executor->completions);
+    executor->children = NULL;
+    executor->completions = NULL;
+    return makespan;
+}
@@ -0,0 +1,105 @@
+/* * * * * * * *  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Description : Module for running a trace for real, as busy work on one   *
+ *               pinned thread per cpu scheduled shortest remaining time    *
+ *               first, to check the simulation against the machine        *
+ * Layout by :  Matt Farrugia <matt.farrugia@unimelb.edu.au>                *
+ * Created by :Syed Ahammad Newaz Saif                                      *
+ * Email : snewaz@student.unimelb.edu.au                                    *
+ * Student ID : 684933                                                      *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * * */
+
+#ifndef EXECUTOR_H
+#define EXECUTOR_H
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include "data.h"
+#include "heap.h"
+#include "loadtree.h"
+#include "trace.h"
+
+/* Processes or subprocesses an inbox holds before the dispatcher waits.
+   A power of two so positions wrap with a mask. */
+#define INBOX_CAPACITY 4096
+
+/* * * * * * * * * * *
+ * TYPE DEFINITIONS  *
+ * * * * * * * * * * */
+
+typedef struct inbox Inbox;
+typedef struct worker Worker;
+typedef struct executor Executor;
+
+/* * * * * * * * * *
+ * DATA STRUCTURES *
+ * * * * * * * * * */
+
+/* Work handed from the dispatcher to one worker. Only the dispatcher moves
+   the tail and only the worker moves the head, so items pass without a
+   lock. The lock is only taken to sleep, by a worker with nothing to do or
+   the dispatcher with nowhere to put an item, and to wake the other. */
+struct inbox
+{
+    Data items[INBOX_CAPACITY];
+    atomic_long head;       // next item for the worker to take
+    atomic_long tail;       // next place for the dispatcher to fill
+    pthread_mutex_t lock;
+    pthread_cond_t nonempty; // signalled once an item is put in
+    pthread_cond_t nonfull;  // signalled once items are taken out
+};
+
+/* A thread standing in for one cpu. Its readyqueue is its own, so only the
+   inbox and the work done are shared. */
+struct worker
+{
+    int cpu;
+    pthread_t thread;
+    Executor *executor;
+    Inbox inbox;
+    Heap *readyqueue;
+    atomic_llong worked;    // units of work done so far
+    long long counted;      // of those, the units taken off the load tree
+};
+
+/* Runs the processes of a trace as busy work, one unit of execution time
+   taking unitns nanoseconds of one core. */
+struct executor
+{
+    int nprocessor;
+    long long unitns;
+    long long spinsperunit;         // iterations of busy work in a unit
+    Worker *workers;
+    LoadTree *load;                 // work placed and not yet done, per worker
+    Trace *trace;
+    atomic_int *children;           // subprocesses yet to finish, per process
+    atomic_llong *completions;      // nanoseconds from the start, per process
+    long long start;                // clock at time 0
+    atomic_int done;                // 1 once every process is handed out
+};
+
+/* * * * * * * * * * * * *
+ * FUNCTION DEFINITIONS  *
+ * * * * * * * * * * * * */
+
+/* Creates an executor of nprocessor workers, a unit of execution time taking
+   unitns nanoseconds. Measures how much busy work that is on this machine.
+   Returns a pointer to it. */
+Executor *new_executor(int nprocessor, long long unitns);
+
+/* Destroys an executor and its associated memory. */
+void free_executor(Executor *executor);
+
+/* Returns the latest arrival time a run can wait for on the clock, a unit
+   taking unitns nanoseconds. */
+long long executor_max_arrival(long long unitns);
+
+/* Runs every process in the trace for real, none of which may arrive after
+   executor_max_arrival. Each arrives on the clock at its arrival time and
+   goes to the worker with the least work outstanding, parallelisable
+   processes split as the simulator splits them. Each worker runs whatever
+   it holds with the least remaining time, a unit at a time, and sleeps
+   while it holds nothing.
+   Returns the measured makespan in nanoseconds. */
+long long executor_run(Executor *executor, Trace *trace);
+
+#endif
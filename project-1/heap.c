@@ -0,0 +1,176 @@
+/* * * * * * * *  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Description : Module for creating and manipulating binary min-heaps of   *
+ *               processes ordered by remaining time and then processid,    *
+ *               or however else a scheduling policy orders them            *
+ * Layout by :  Matt Farrugia <matt.farrugia@unimelb.edu.au>                *
+ * Created by :Syed Ahammad Newaz Saif                                      *
+ * Email : snewaz@student.unimelb.edu.au                                    *
+ * Student ID : 684933                                                      *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * * */
+
+/* List of libraries for the assignment */
+#include <stdlib.h>
+#include <assert.h>
+#include "heap.h"
+
+/* Initial number of items a heap has room for before it grows. */
+#define INITIAL_CAPACITY 8
+
+/* Helper function that returns whether data a runs before data b,
+   by the order the heap was made with. */
+int heap_before(Heap *heap, Data *a, Data *b);
+
+/* Helper function to swap the items at positions i and j. */
+void heap_swap(Heap *heap, int i, int j);
+
+/* Helper function that moves the item at position i down until neither
+   of its children runs before it. */
+void heap_sift_down(Heap *heap, int i);
+
+/* * * * * * * * * * * * *
+ * FUNCTION DEFINITIONS  *
+ * * * * * * * * * * * * */
+
+/* Creates a new heap ordered by remaining time, then by processid,
+   and returns a pointer to it. */
+Heap *new_heap()
+{
+    return new_heap_ordered(shortest_first);
+}
+
+/* Creates a new heap whose top is whichever item runs before all the others
+   by before, and returns a pointer to it. */
+Heap *new_heap_ordered(HeapOrder before)
+{
+    assert(before != NULL);
+    Heap *heap = malloc(sizeof *heap);
+    assert(heap);
+
+    heap->items = malloc(sizeof(Data) * INITIAL_CAPACITY);
+    assert(heap->items);
+    heap->size = 0;
+    heap->capacity = INITIAL_CAPACITY;
+    heap->before = before;
+
+    return heap;
+}
+
+/* Destroys a heap and its associated memory. */
+void free_heap(Heap *heap)
+{
+    assert(heap != NULL);
+    // free the array of items, and the heap itself
+    free(heap->items);
+    free(heap);
+}
+
+/* Returns whether data a runs before data b when sorted by remaining time,
+   then by processid if remaining times are the same. */
+int shortest_first(const Data *a, const Data *b)
+{
+    if (a->remainingtime != b->remainingtime)
+    {
+        return a->remainingtime < b->remainingtime;
+    }
+    return processid_before(a, b);
+}
+
+/* Helper function that returns whether data a runs before data b,
+   by the order the heap was made with. */
+int heap_before(Heap *heap, Data *a, Data *b)
+{
+    return heap->before(a, b);
+}
+
+/* Helper function to swap the items at positions i and j. */
+void heap_swap(Heap *heap, int i, int j)
+{
+    Data temp = heap->items[i];
+    heap->items[i] = heap->items[j];
+    heap->items[j] = temp;
+}
+
+/* Inserts a new item into a heap. O(log n). */
+void heap_insert(Heap *heap, Data data)
+{
+    assert(heap != NULL);
+
+    // double the room when full
+    if (heap->size == heap->capacity)
+    {
+        heap->capacity *= 2;
+        heap->items = realloc(heap->items, sizeof(Data) * heap->capacity);
+        assert(heap->items);
+    }
+
+    // place at the bottom and sift up while it runs before its parent
+    int i = heap->size++;
+    heap->items[i] = data;
+    while (i > 0 && heap_before(heap, &heap->items[i], &heap->items[(i - 1) / 2]))
+    {
+        heap_swap(heap, i, (i - 1) / 2);
+        i = (i - 1) / 2;
+    }
+}
+
+/* Removes and returns the item that runs first (by default the one with the
+   least remaining time). O(log n).
+   Error if the heap is empty (so first ensure heap_size() > 0). */
+Data heap_remove_min(Heap *heap)
+{
+    assert(heap != NULL);
+    assert(heap->size > 0);
+
+    // save the top, then move the last item up and sift it down
+    Data data = heap->items[0];
+    heap->size--;
+    heap->items[0] = heap->items[heap->size];
+    heap_sift_down(heap, 0);
+
+    // done!
+    return data;
+}
+
+/* Helper function that moves the item at position i down until neither
+   of its children runs before it. */
+void heap_sift_down(Heap *heap, int i)
+{
+    while (1)
+    {
+        int left = 2 * i + 1;
+        int right = left + 1;
+        int first = i;
+        if (left < heap->size && heap_before(heap, &heap->items[left], &heap->items[first]))
+        {
+            first = left;
+        }
+        if (right < heap->size && heap_before(heap, &heap->items[right], &heap->items[first]))
+        {
+            first = right;
+        }
+        if (first == i)
+        {
+            break;
+        }
+        heap_swap(heap, i, first);
+        i = first;
+    }
+}
+
+/* Returns the item that runs first without removing it. O(1).
+   It may only be changed in place in ways that keep it first, such as
+   decreasing its remaining time in the default order.
+   Error if the heap is empty (so first ensure heap_size() > 0). */
+Data *heap_peek_min(Heap *heap)
+{
+    assert(heap != NULL);
+    assert(heap->size > 0);
+    return &heap->items[0];
+}
+
+/* Returns the number of items currently in a heap. */
+int heap_size(Heap *heap)
+{
+    assert(heap != NULL);
+    return heap->size;
+}
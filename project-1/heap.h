@@ -0,0 +1,76 @@
+/* * * * * * * *  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Description : Module for creating and manipulating binary min-heaps of   *
+ *               processes ordered by remaining time and then processid,    *
+ *               or however else a scheduling policy orders them            *
+ * Layout by :  Matt Farrugia <matt.farrugia@unimelb.edu.au>                *
+ * Created by :Syed Ahammad Newaz Saif                                      *
+ * Email : snewaz@student.unimelb.edu.au                                    *
+ * Student ID : 684933                                                      *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * * */
+
+#ifndef HEAP_H
+#define HEAP_H
+
+#include "data.h"
+
+/* * * * * * * * * * *
+ * TYPE DEFINITIONS  *
+ * * * * * * * * * * */
+
+typedef struct heap Heap;
+
+/* Returns whether a runs before b. */
+typedef int (*HeapOrder)(const Data *a, const Data *b);
+
+/* * * * * * * * * *
+ * DATA STRUCTURES *
+ * * * * * * * * * */
+
+/* A heap keeps its items in a growable array where items[0] is always the
+   process that runs first, by default the one with the least remaining
+   time (lower processid on a tie). */
+struct heap
+{
+    Data *items;
+    int size;
+    int capacity;
+    HeapOrder before;
+};
+
+/* * * * * * * * * * * * *
+ * FUNCTION DEFINITIONS  *
+ * * * * * * * * * * * * */
+
+/* Creates a new heap ordered by remaining time, then by processid,
+   and returns a pointer to it. */
+Heap *new_heap();
+
+/* Creates a new heap whose top is whichever item runs before all the others
+   by before, and returns a pointer to it. */
+Heap *new_heap_ordered(HeapOrder before);
+
+/* Returns whether data a runs before data b when sorted by remaining time,
+   then by processid if remaining times are the same. */
+int shortest_first(const Data *a, const Data *b);
+
+/* Destroys a heap and its associated memory. */
+void free_heap(Heap *heap);
+
+/* Inserts a new item into a heap. O(log n). */
+void heap_insert(Heap *heap, Data data);
+
+/* Removes and returns the item that runs first (by default the one with the
+   least remaining time). O(log n).
+   Error if the heap is empty (so first ensure heap_size() > 0). */
+Data heap_remove_min(Heap *heap);
+
+/* Returns the item that runs first without removing it. O(1).
+   It may only be changed in place in ways that keep it first, such as
+   decreasing its remaining time in the default order.
+   Error if the heap is empty (so first ensure heap_size() > 0). */
+Data *heap_peek_min(Heap *heap);
+
+/* Returns the number of items currently in a heap. */
+int heap_size(Heap *heap);
+
+#endif
@@ -0,0 +1,138 @@
+/* * * * * * * *  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Description : Module for fixed size, log bucketed histograms of values  *
+ *               recorded online, answering percentiles to within 1%        *
+ * Layout by :  Matt Farrugia <matt.farrugia@unimelb.edu.au>                *
+ * Created by :Syed Ahammad Newaz Saif                                      *
+ * Email : snewaz@student.unimelb.edu.au                                    *
+ * Student ID : 684933                                                      *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * * */
+
+/* List of libraries for the assignment */
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <limits.h>
+#include <assert.h>
+#include "histogram.h"
+
+/* Helper function that finds the bucket a value is counted in. */
+int bucket_of(long long value);
+
+/* Helper function that finds the largest value counted in a bucket. */
+long long bucket_highest(int bucket);
+
+/* * * * * * * * * * * * *
+ * FUNCTION DEFINITIONS  *
+ * * * * * * * * * * * * */
+
+/* Resets the histogram to no values recorded. */
+void histogram_init(Histogram *histogram)
+{
+    assert(histogram != NULL);
+    memset(histogram->counts, 0, sizeof histogram->counts);
+    histogram->total = 0;
+    histogram->min = LLONG_MAX;
+    histogram->max = 0;
+}
+
+/* Helper function that finds the bucket a value is counted in. */
+int bucket_of(long long value)
+{
+    if (value < SUB_BUCKETS)
+    {
+        return (int)value;
+    }
+
+    // shift the value down until it is within the top half of the sub buckets
+    int shift = 0;
+    while ((value >> shift) >= SUB_BUCKETS)
+    {
+        shift++;
+    }
+    return SUB_BUCKETS + (shift - 1) * HALF_SUB_BUCKETS + (int)(value >> shift) - HALF_SUB_BUCKETS;
+}
+
+/* Helper function that finds the largest value counted in a bucket. */
+long long bucket_highest(int bucket)
+{
+    if (bucket < SUB_BUCKETS)
+    {
+        return bucket;
+    }
+    int shift = (bucket - SUB_BUCKETS) / HALF_SUB_BUCKETS + 1;
+    long long sub = (bucket - SUB_BUCKETS) % HALF_SUB_BUCKETS + HALF_SUB_BUCKETS;
+
+    // the top bucket would overflow one past its end
+    if (sub + 1 > (LLONG_MAX >> shift))
+    {
+        return LLONG_MAX;
+    }
+    return ((sub + 1) << shift) - 1;
+}
+
+/* Records a non negative value. O(1). */
+void histogram_record(Histogram *histogram, long long value)
+{
+    assert(histogram != NULL && value >= 0);
+    histogram->counts[bucket_of(value)]++;
+    histogram->total++;
+    if (value < histogram->min)
+    {
+        histogram->min = value;
+    }
+    if (value > histogram->max)
+    {
+        histogram->max = value;
+    }
+}
+
+/* Adds the values recorded in from onto into, as if they had all been
+   recorded on into. */
+void histogram_merge(Histogram *into, const Histogram *from)
+{
+    assert(into != NULL && from != NULL);
+    for (int i = 0; i < HISTOGRAM_BUCKETS; i++)
+    {
+        into->counts[i] += from->counts[i];
+    }
+    into->total += from->total;
+    if (from->min < into->min)
+    {
+        into->min = from->min;
+    }
+    if (from->max > into->max)
+    {
+        into->max = from->max;
+    }
+}
+
+/* Returns the value at or below which percentile percent of the values
+   recorded fall, to within the width of its bucket and never beyond the
+   largest value recorded. Returns 0 if nothing has been recorded. */
+long long histogram_percentile(const Histogram *histogram, double percentile)
+{
+    assert(histogram != NULL);
+    if (histogram->total == 0)
+    {
+        return 0;
+    }
+
+    // the rank of the value wanted, counting from 1
+    long long rank = (long long)ceil(percentile / 100 * histogram->total);
+    if (rank < 1)
+    {
+        rank = 1;
+    }
+
+    long long seen = 0;
+    for (int i = 0; i < HISTOGRAM_BUCKETS; i++)
+    {
+        seen += histogram->counts[i];
+        if (seen >= rank)
+        {
+            long long value = bucket_highest(i);
+            return (value < histogram->max) ? value : histogram->max;
+        }
+    }
+    return histogram->max;
+}
@@ -0,0 +1,61 @@
+/* * * * * * * *  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Description : Module for fixed size, log bucketed histograms of values  *
+ *               recorded online, answering percentiles to within 1%        *
+ * Layout by :  Matt Farrugia <matt.farrugia@unimelb.edu.au>                *
+ * Created by :Syed Ahammad Newaz Saif                                      *
+ * Email : snewaz@student.unimelb.edu.au                                    *
+ * Student ID : 684933                                                      *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * * */
+
+#ifndef HISTOGRAM_H
+#define HISTOGRAM_H
+
+/* Values below 2^SUB_BUCKET_BITS get a bucket each. Each doubling above
+   that is split into 2^(SUB_BUCKET_BITS - 1) buckets of equal width, so a
+   bucket is never wider than 1/64 of the values in it. */
+#define SUB_BUCKET_BITS 7
+#define SUB_BUCKETS (1 << SUB_BUCKET_BITS)
+#define HALF_SUB_BUCKETS (SUB_BUCKETS / 2)
+#define HISTOGRAM_BUCKETS (SUB_BUCKETS + (63 - SUB_BUCKET_BITS) * HALF_SUB_BUCKETS)
+
+/* * * * * * * * * * *
+ * TYPE DEFINITIONS  *
+ * * * * * * * * * * */
+
+typedef struct histogram Histogram;
+
+/* * * * * * * * * *
+ * DATA STRUCTURES *
+ * * * * * * * * * */
+
+/* Counts of the non negative values recorded, by bucket. The size is fixed
+   whatever the number or range of values, and two histograms merge by
+   adding up their counts. */
+struct histogram
+{
+    long long counts[HISTOGRAM_BUCKETS];
+    long long total;    // values recorded
+    long long min;
+    long long max;
+};
+
+/* * * * * * * * * * * * *
+ * FUNCTION DEFINITIONS  *
+ * * * * * * * * * * * * */
+
+/* Resets the histogram to no values recorded. */
+void histogram_init(Histogram *histogram);
+
+/* Records a non negative value. O(1). */
+void histogram_record(Histogram *histogram, long long value);
+
+/* Adds the values recorded in from onto into, as if they had all been
+   recorded on into. */
+void histogram_merge(Histogram *into, const Histogram *from);
+
+/* Returns the value at or below which percentile percent of the values
+   recorded fall, to within the width of its bucket and never beyond the
+   largest value recorded. Returns 0 if nothing has been recorded. */
+long long histogram_percentile(const Histogram *histogram, double percentile);
+
+#endif
@@ -0,0 +1,113 @@
+/* * * * * * * *  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Description : Module for a tournament tree that keeps the outstanding    *
+ *               remaining time of every cpu and names the least loaded one *
+ * Layout by :  Matt Farrugia <matt.farrugia@unimelb.edu.au>                *
+ * Created by :Syed Ahammad Newaz Saif                                      *
+ * Email : snewaz@student.unimelb.edu.au                                    *
+ * Student ID : 684933                                                      *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * * */
+
+/* List of libraries for the assignment */
+#include <stdlib.h>
+#include <assert.h>
+#include "loadtree.h"
+
+/* Helper function that returns which of cpu a and b wins a match. */
+int loadtree_match(LoadTree *tree, int a, int b);
+
+/* * * * * * * * * * * * *
+ * FUNCTION DEFINITIONS  *
+ * * * * * * * * * * * * */
+
+/* Creates a new tree of nprocessor idle cpus and returns a pointer to it. */
+LoadTree *new_loadtree(int nprocessor)
+{
+    assert(nprocessor > 0);
+    LoadTree *tree = malloc(sizeof *tree);
+    assert(tree);
+
+    // round the leaves up to a full level
+    tree->leaves = 1;
+    while (tree->leaves < nprocessor)
+    {
+        tree->leaves *= 2;
+    }
+    tree->nprocessor = nprocessor;
+    tree->load = calloc(nprocessor, sizeof(long long));
+    tree->winner = malloc(sizeof(int) * 2 * tree->leaves);
+    assert(tree->load && tree->winner);
+
+    // padding leaves hold -1 and never win
+    for (int i = 0; i < tree->leaves; i++)
+    {
+        tree->winner[tree->leaves + i] = (i < nprocessor) ? i : -1;
+    }
+    for (int node = tree->leaves - 1; node > 0; node--)
+    {
+        tree->winner[node] = loadtree_match(tree, tree->winner[2 * node], tree->winner[2 * node + 1]);
+    }
+
+    return tree;
+}
+
+/* Destroys a tree and its associated memory. */
+void free_loadtree(LoadTree *tree)
+{
+    assert(tree != NULL);
+    free(tree->load);
+    free(tree->winner);
+    free(tree);
+}
+
+/* Helper function that returns which of cpu a and b wins a match.
+   The least load wins, then the lowest cpu id. */
+int loadtree_match(LoadTree *tree, int a, int b)
+{
+    if (a == -1)
+    {
+        return b;
+    }
+    if (b == -1)
+    {
+        return a;
+    }
+    if (tree->load[b] < tree->load[a])
+    {
+        return b;
+    }
+    if (tree->load[a] < tree->load[b])
+    {
+        return a;
+    }
+    return a < b ? a : b;
+}
+
+/* Adds amount (which may be negative) to the load of a cpu. O(log P). */
+void loadtree_add(LoadTree *tree, int cpu, long long amount)
+{
+    assert(tree != NULL);
+    assert(cpu >= 0 && cpu < tree->nprocessor);
+
+    tree->load[cpu] += amount;
+
+    // replay the matches on the path from the leaf up to the root
+    for (int node = (tree->leaves + cpu) / 2; node > 0; node /= 2)
+    {
+        tree->winner[node] = loadtree_match(tree, tree->winner[2 * node], tree->winner[2 * node + 1]);
+    }
+}
+
+/* Returns the cpu with the least load, lowest cpu id on a tie. O(1). */
+int loadtree_min(LoadTree *tree)
+{
+    assert(tree != NULL);
+    // a single cpu is its own root
+    return tree->winner[1];
+}
+
+/* Returns the outstanding remaining time of a cpu. O(1). */
+long long loadtree_load(LoadTree *tree, int cpu)
+{
+    assert(tree != NULL);
+    return tree->load[cpu];
+}
@@ -0,0 +1,53 @@
+/* * * * * * * *  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Description : Module for a tournament tree that keeps the outstanding    *
+ *               remaining time of every cpu and names the least loaded one *
+ * Layout by :  Matt Farrugia <matt.farrugia@unimelb.edu.au>                *
+ * Created by :Syed Ahammad Newaz Saif                                      *
+ * Email : snewaz@student.unimelb.edu.au                                    *
+ * Student ID : 684933                                                      *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * * */
+
+#ifndef LOADTREE_H
+#define LOADTREE_H
+
+/* * * * * * * * * * *
+ * TYPE DEFINITIONS  *
+ * * * * * * * * * * */
+
+typedef struct loadtree LoadTree;
+
+/* * * * * * * * * *
+ * DATA STRUCTURES *
+ * * * * * * * * * */
+
+/* The leaves of the tree are the cpus and every internal node stores the
+   winner (least load, then lowest cpu id) of its two children, so the root
+   is always the cpu a new process should be placed on. */
+struct loadtree
+{
+    long long *load; // outstanding remaining time of each cpu
+    int *winner;     // cpu id winning each node, leaves start at 'leaves'
+    int leaves;      // number of leaves, a power of two >= nprocessor
+    int nprocessor;
+};
+
+/* * * * * * * * * * * * *
+ * FUNCTION DEFINITIONS  *
+ * * * * * * * * * * * * */
+
+/* Creates a new tree of nprocessor idle cpus and returns a pointer to it. */
+LoadTree *new_loadtree(int nprocessor);
+
+/* Destroys a tree and its associated memory. */
+void free_loadtree(LoadTree *tree);
+
+/* Adds amount (which may be negative) to the load of a cpu. O(log P). */
+void loadtree_add(LoadTree *tree, int cpu, long long amount);
+
+/* Returns the cpu with the least load, lowest cpu id on a tie. O(1). */
+int loadtree_min(LoadTree *tree);
+
+/* Returns the outstanding remaining time of a cpu. O(1). */
+long long loadtree_load(LoadTree *tree, int cpu);
+
+#endif
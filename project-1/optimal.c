@@ -0,0 +1,531 @@
+/* * * * * * * *  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Description : Module for finding the least makespan a plan can have, by  *
+ *               branch and bound over which cpu each job goes to, subtrees *
+ *               shared out between threads that steal from each other      *
+ * Layout by :  Matt Farrugia <matt.farrugia@unimelb.edu.au>                *
+ * Created by :Syed Ahammad Newaz Saif                                      *
+ * Email : snewaz@student.unimelb.edu.au                                    *
+ * Student ID : 684933                                                      *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * * */
+
+/* sorting with a context is a GNU extension */
+#define _GNU_SOURCE
+
+/* List of libraries for the assignment */
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <time.h>
+#include <sched.h>
+#include "optimal.h"
+#include "bounds.h"
+
+/* Helper function that returns the monotonic clock in nanoseconds. */
+long long monotonic_ns();
+
+/* Helper function that orders jobs longest first, then as they run. */
+int compare_branch(const void *a, const void *b, void *plan);
+
+/* Helper function that counts steps of work done by a searcher, looking at
+   the clock now and then.
+   Returns 1 once the search is to stop. */
+int out_of_time(Searcher *searcher, long long steps);
+
+/* Helper function that hands a subtree to the back of a deque. */
+void deque_push(Deque *deque, Subtree *subtree);
+
+/* Helper function that takes the newest subtree of a deque, NULL if empty. */
+Subtree *deque_pop(Deque *deque);
+
+/* Helper function that takes the oldest subtree of a deque, NULL if empty. */
+Subtree *deque_steal(Deque *deque);
+
+/* Helper function that returns when a cpu would finish with job as well. */
+long long completion_adding(Search *search, SearchCpu *cpu, int job);
+
+/* Helper function that places a job on a cpu in the order it runs. */
+void searchcpu_add(Search *search, SearchCpu *cpu, int job);
+
+/* Helper function that takes a job back off a cpu. */
+void searchcpu_remove(Search *search, SearchCpu *cpu, int job);
+
+/* Helper function that returns whether two cpus hold jobs of the same
+   arrival times and lengths, so either is as good a place as the other. */
+int same_jobs(Search *search, SearchCpu *a, SearchCpu *b);
+
+/* Helper function that sets a searcher up at the root of a subtree. */
+void searcher_reset(Searcher *searcher, Subtree *subtree);
+
+/* Helper function that searches below the node reached after depth jobs
+   have been branched on. */
+void search_node(Searcher *searcher, int depth);
+
+/* Helper function that each thread runs, searching subtrees until there
+   are none left. */
+void *search_worker(void *argument);
+
+/* * * * * * * * * * * * *
+ * FUNCTION DEFINITIONS  *
+ * * * * * * * * * * * * */
+
+/* Helper function that returns the monotonic clock in nanoseconds. */
+long long monotonic_ns()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (long long)now.tv_sec * 1000000000LL + now.tv_nsec;
+}
+
+/* Helper function that counts steps of work done by a searcher, looking at
+   the clock now and then.
+   Returns 1 once the search is to stop. */
+int out_of_time(Searcher *searcher, long long steps)
+{
+    Search *search = searcher->search;
+    searcher->steps += steps;
+    if (searcher->steps >= CLOCK_INTERVAL)
+    {
+        searcher->steps = 0;
+        if (monotonic_ns() > search->deadline)
+        {
+            atomic_store(&search->stop, 1);
+        }
+    }
+    return atomic_load_explicit(&search->stop, memory_order_relaxed);
+}
+
+/* Helper function that hands a subtree to the back of a deque. */
+void deque_push(Deque *deque, Subtree *subtree)
+{
+    pthread_mutex_lock(&deque->lock);
+    if (deque->tail == deque->capacity)
+    {
+        // slide down over what thieves have taken before growing
+        memmove(deque->items, deque->items + deque->head, sizeof(Subtree *) * (deque->tail - deque->head));
+        deque->tail -= deque->head;
+        deque->head = 0;
+        if (deque->tail == deque->capacity)
+        {
+            deque->capacity *= 2;
+            deque->items = realloc(deque->items, sizeof(Subtree *) * deque->capacity);
+            assert(deque->items);
+        }
+    }
+    deque->items[deque->tail++] = subtree;
+    pthread_mutex_unlock(&deque->lock);
+}
+
+/* Helper function that takes the newest subtree of a deque, NULL if empty. */
+Subtree *deque_pop(Deque *deque)
+{
+    pthread_mutex_lock(&deque->lock);
+    Subtree *subtree = (deque->tail > deque->head) ? deque->items[--deque->tail] : NULL;
+    pthread_mutex_unlock(&deque->lock);
+    return subtree;
+}
+
+/* Helper function that takes the oldest subtree of a deque, NULL if empty. */
+Subtree *deque_steal(Deque *deque)
+{
+    pthread_mutex_lock(&deque->lock);
+    Subtree *subtree = (deque->tail > deque->head) ? deque->items[deque->head++] : NULL;
+    pthread_mutex_unlock(&deque->lock);
+    return subtree;
+}
+
+/* Helper function that returns when a cpu would finish with job as well. */
+long long completion_adding(Search *search, SearchCpu *cpu, int job)
+{
+    Job *jobs = search->plan->jobs;
+    long long time = 0;
+    int added = 0;
+    for (int i = 0; i <= cpu->size; i++)
+    {
+        // the job goes in before the first job it runs before
+        Job *next = (i < cpu->size) ? &jobs[cpu->jobs[i]] : NULL;
+        if (!added && (next == NULL || job_runs_before(&jobs[job], next)))
+        {
+            time = (time > jobs[job].arrivaltime ? time : jobs[job].arrivaltime) + jobs[job].data.remainingtime;
+            added = 1;
+        }
+        if (next != NULL)
+        {
+            time = (time > next->arrivaltime ? time : next->arrivaltime) + next->data.remainingtime;
+        }
+    }
+    return time;
+}
+
+/* Helper function that places a job on a cpu in the order it runs. */
+void searchcpu_add(Search *search, SearchCpu *cpu, int job)
+{
+    if (cpu->size == cpu->capacity)
+    {
+        cpu->capacity *= 2;
+        cpu->jobs = realloc(cpu->jobs, sizeof(int) * cpu->capacity);
+        assert(cpu->jobs);
+    }
+    cpu->completion = completion_adding(search, cpu, job);
+    int position = cpu->size;
+    while (position > 0 && job_runs_before(&search->plan->jobs[job], &search->plan->jobs[cpu->jobs[position - 1]]))
+    {
+        cpu->jobs[position] = cpu->jobs[position - 1];
+        position--;
+    }
+    cpu->jobs[position] = job;
+    cpu->size++;
+}
+
+/* Helper function that takes a job back off a cpu. */
+void searchcpu_remove(Search *search, SearchCpu *cpu, int job)
+{
+    Job *jobs = search->plan->jobs;
+    long long time = 0;
+    int kept = 0;
+    for (int i = 0; i < cpu->size; i++)
+    {
+        if (cpu->jobs[i] == job)
+        {
+            continue;
+        }
+        cpu->jobs[kept++] = cpu->jobs[i];
+        time = (time > jobs[cpu->jobs[i]].arrivaltime ? time : jobs[cpu->jobs[i]].arrivaltime) + jobs[cpu->jobs[i]].data.remainingtime;
+    }
+    cpu->size = kept;
+    cpu->completion = time;
+}
+
+/* Helper function that returns whether two cpus hold jobs of the same
+   arrival times and lengths, so either is as good a place as the other. */
+int same_jobs(Search *search, SearchCpu *a, SearchCpu *b)
+{
+    if (a->size != b->size || a->completion != b->completion)
+    {
+        return 0;
+    }
+    Job *jobs = search->plan->jobs;
+    for (int i = 0; i < a->size; i++)
+    {
+        Job *first = &jobs[a->jobs[i]];
+        Job *second = &jobs[b->jobs[i]];
+        if (first->arrivaltime != second->arrivaltime || first->data.remainingtime != second->data.remainingtime)
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* Helper function that sets a searcher up at the root of a subtree. */
+void searcher_reset(Searcher *searcher, Subtree *subtree)
+{
+    Search *search = searcher->search;
+    for (int c = 0; c < search->nprocessor; c++)
+    {
+        searcher->cpus[c].size = 0;
+        searcher->cpus[c].completion = 0;
+    }
+
+    // subprocesses never move, then the choices leading to the subtree
+    for (int j = 0; j < search->plan->njobs; j++)
+    {
+        if (search->plan->jobs[j].pinned)
+        {
+            searchcpu_add(search, &searcher->cpus[search->plan->jobs[j].cpu], j);
+        }
+    }
+    for (int d = 0; d < subtree->depth; d++)
+    {
+        searcher->chosen[d] = subtree->cpus[d];
+        searchcpu_add(search, &searcher->cpus[subtree->cpus[d]], search->branch[d]);
+    }
+}
+
+/* Helper function that searches below the node reached after depth jobs
+   have been branched on. */
+void search_node(Searcher *searcher, int depth)
+{
+    Search *search = searcher->search;
+    int nprocessor = search->nprocessor;
+    SearchCpu *cpus = searcher->cpus;
+
+    searcher->nodes++;
+    if (out_of_time(searcher, 1))
+    {
+        return;
+    }
+
+    long long best = atomic_load(&search->best);
+    long long makespan = 0;
+    for (int c = 0; c < nprocessor; c++)
+    {
+        makespan = (cpus[c].completion > makespan) ? cpus[c].completion : makespan;
+    }
+
+    // a complete plan better than the best so far is the new best
+    if (depth == search->nbranch)
+    {
+        if (makespan < best)
+        {
+            pthread_mutex_lock(&search->lock);
+            if (makespan < atomic_load(&search->best))
+            {
+                for (int j = 0; j < search->plan->njobs; j++)
+                {
+                    search->bestcpus[j] = search->plan->jobs[j].cpu;
+                }
+                for (int d = 0; d < depth; d++)
+                {
+                    search->bestcpus[search->branch[d]] = searcher->chosen[d];
+                }
+                atomic_store(&search->best, makespan);
+            }
+            pthread_mutex_unlock(&search->lock);
+        }
+        return;
+    }
+
+    // each job left must finish somewhere, at best on the cpu it suits most
+    long long bound = (search->bound > makespan) ? search->bound : makespan;
+    for (int d = depth; d < search->nbranch && bound < best; d++)
+    {
+        long long soonest = -1;
+        for (int c = 0; c < nprocessor; c++)
+        {
+            long long completion = completion_adding(search, &cpus[c], search->branch[d]);
+            soonest = (soonest == -1 || completion < soonest) ? completion : soonest;
+        }
+        bound = (soonest > bound) ? soonest : bound;
+        // large traces can spend a long time on a single bound
+        if (out_of_time(searcher, depth + nprocessor))
+        {
+            return;
+        }
+    }
+    if (bound >= best)
+    {
+        return;
+    }
+
+    // the cpus worth trying, the one finishing the job soonest first
+    int job = search->branch[depth];
+    int *order = malloc(sizeof(int) * nprocessor);
+    long long *completions = malloc(sizeof(long long) * nprocessor);
+    assert(order && completions);
+    int ncandidates = 0;
+    for (int c = 0; c < nprocessor; c++)
+    {
+        int repeat = 0;
+        for (int earlier = 0; earlier < c && !repeat; earlier++)
+        {
+            repeat = same_jobs(search, &cpus[earlier], &cpus[c]);
+        }
+        long long completion = completion_adding(search, &cpus[c], job);
+        if (repeat || completion >= best)
+        {
+            continue;
+        }
+        int position = ncandidates++;
+        while (position > 0 && completions[position - 1] > completion)
+        {
+            order[position] = order[position - 1];
+            completions[position] = completions[position - 1];
+            position--;
+        }
+        order[position] = c;
+        completions[position] = completion;
+    }
+
+    if (depth < SPLIT_DEPTH)
+    {
+        // near the root each choice becomes a subtree other threads can
+        // take, pushed so the most promising is searched next
+        for (int i = ncandidates - 1; i >= 0; i--)
+        {
+            Subtree *subtree = malloc(sizeof *subtree);
+            assert(subtree);
+            subtree->depth = depth + 1;
+            subtree->cpus = malloc(sizeof(int) * (depth + 1));
+            assert(subtree->cpus);
+            memcpy(subtree->cpus, searcher->chosen, sizeof(int) * depth);
+            subtree->cpus[depth] = order[i];
+            atomic_fetch_add(&search->outstanding, 1);
+            deque_push(&searcher->deque, subtree);
+        }
+    }
+    else
+    {
+        for (int i = 0; i < ncandidates; i++)
+        {
+            searcher->chosen[depth] = order[i];
+            searchcpu_add(search, &cpus[order[i]], job);
+            search_node(searcher, depth + 1);
+            searchcpu_remove(search, &cpus[order[i]], job);
+        }
+    }
+    free(order);
+    free(completions);
+}
+
+/* Helper function that each thread runs, searching subtrees until there
+   are none left. */
+void *search_worker(void *argument)
+{
+    Searcher *searcher = argument;
+    Search *search = searcher->search;
+    while (1)
+    {
+        // its own newest subtree first, then the oldest of another thread's
+        Subtree *subtree = deque_pop(&searcher->deque);
+        for (int k = 1; subtree == NULL && k < search->nthreads; k++)
+        {
+            subtree = deque_steal(&search->searchers[(searcher->id + k) % search->nthreads].deque);
+        }
+
+        if (subtree != NULL)
+        {
+            if (!atomic_load(&search->stop))
+            {
+                searcher_reset(searcher, subtree);
+                search_node(searcher, subtree->depth);
+            }
+            free(subtree->cpus);
+            free(subtree);
+            // any subtrees it made were counted before it is let go
+            atomic_fetch_sub(&search->outstanding, 1);
+        }
+        else if (atomic_load(&search->outstanding) == 0)
+        {
+            return NULL;
+        }
+        else
+        {
+            sched_yield();
+        }
+    }
+}
+
+/* Helper function that orders jobs longest first, then as they run. */
+int compare_branch(const void *a, const void *b, void *plan)
+{
+    Job *first = &((Plan *)plan)->jobs[*(const int *)a];
+    Job *second = &((Plan *)plan)->jobs[*(const int *)b];
+    if (first->data.remainingtime != second->data.remainingtime)
+    {
+        return (first->data.remainingtime < second->data.remainingtime) ? 1 : -1;
+    }
+    return job_runs_before(second, first) - job_runs_before(first, second);
+}
+
+/* Searches for the plan of the same jobs with the least makespan, starting
+   from plan as the best so far and keeping subprocesses on their cpus.
+   Subtrees are left out once a lower bound shows they cannot do better,
+   and cpus holding the same jobs are only branched to once. Runs on
+   nthreads threads for at most budgetns nanoseconds, then replans plan as
+   the best found and stores the nodes searched in nodes.
+   Returns 1 if the best found is proven the least possible, 0 if the time
+   ran out first. */
+int optimise_plan(Plan *plan, int nthreads, long long budgetns, long long *nodes)
+{
+    assert(plan != NULL && nthreads >= 1 && nodes != NULL);
+    Search search;
+    search.plan = plan;
+    search.nprocessor = plan->nprocessor;
+    search.deadline = monotonic_ns() + budgetns;
+    search.nthreads = nthreads;
+    atomic_init(&search.best, plan_makespan(plan));
+    atomic_init(&search.outstanding, 1);
+    atomic_init(&search.stop, 0);
+    pthread_mutex_init(&search.lock, NULL);
+
+    // the longest jobs are branched on first, where they prune the most
+    search.branch = malloc(sizeof(int) * (plan->njobs + 1));
+    search.bestcpus = malloc(sizeof(int) * (plan->njobs + 1));
+    assert(search.branch && search.bestcpus);
+    search.nbranch = 0;
+    long long work = 0;
+    search.bound = 0;
+    for (int j = 0; j < plan->njobs; j++)
+    {
+        Job *job = &plan->jobs[j];
+        search.bestcpus[j] = job->cpu;
+        work += job->data.remainingtime;
+        if (job->arrivaltime + job->data.remainingtime > search.bound)
+        {
+            search.bound = job->arrivaltime + job->data.remainingtime;
+        }
+        if (!job->pinned)
+        {
+            search.branch[search.nbranch++] = j;
+        }
+    }
+    qsort_r(search.branch, search.nbranch, sizeof(int), compare_branch, plan);
+    if ((work + search.nprocessor - 1) / search.nprocessor > search.bound)
+    {
+        search.bound = (work + search.nprocessor - 1) / search.nprocessor;
+    }
+    Bounds bounds;
+    Split split = all_split();
+    compute_bounds(plan->trace, plan->nprocessor, &split, &bounds);
+    search.bound = (bounds.makespan > search.bound) ? bounds.makespan : search.bound;
+
+    // the whole tree starts with the first thread, the rest steal from it
+    search.searchers = malloc(sizeof(Searcher) * nthreads);
+    assert(search.searchers);
+    for (int t = 0; t < nthreads; t++)
+    {
+        Searcher *searcher = &search.searchers[t];
+        searcher->id = t;
+        searcher->search = &search;
+        searcher->nodes = 0;
+        searcher->steps = 0;
+        searcher->deque.capacity = 16;
+        searcher->deque.head = 0;
+        searcher->deque.tail = 0;
+        searcher->deque.items = malloc(sizeof(Subtree *) * searcher->deque.capacity);
+        pthread_mutex_init(&searcher->deque.lock, NULL);
+        searcher->cpus = malloc(sizeof(SearchCpu) * search.nprocessor);
+        searcher->chosen = malloc(sizeof(int) * (search.nbranch + 1));
+        assert(searcher->deque.items && searcher->cpus && searcher->chosen);
+        for (int c = 0; c < search.nprocessor; c++)
+        {
+            searcher->cpus[c].capacity = INITIAL_SEARCH_JOBS;
+            searcher->cpus[c].jobs = malloc(sizeof(int) * searcher->cpus[c].capacity);
+            assert(searcher->cpus[c].jobs);
+        }
+    }
+    Subtree *root = malloc(sizeof *root);
+    assert(root);
+    root->depth = 0;
+    root->cpus = NULL;
+    deque_push(&search.searchers[0].deque, root);
+
+    for (int t = 0; t < nthreads; t++)
+    {
+        int created = pthread_create(&search.searchers[t].thread, NULL, search_worker, &search.searchers[t]);
+        assert(created == 0);
+    }
+    *nodes = 0;
+    for (int t = 0; t < nthreads; t++)
+    {
+        Searcher *searcher = &search.searchers[t];
+        pthread_join(searcher->thread, NULL);
+        *nodes += searcher->nodes;
+        for (int c = 0; c < search.nprocessor; c++)
+        {
+            free(searcher->cpus[c].jobs);
+        }
+        free(searcher->cpus);
+        free(searcher->chosen);
+        free(searcher->deque.items);
+        pthread_mutex_destroy(&searcher->deque.lock);
+    }
+
+    int proven = !atomic_load(&search.stop);
+    plan_assign(plan, search.bestcpus);
+    free(search.searchers);
+    free(search.branch);
+    free(search.bestcpus);
+    pthread_mutex_destroy(&search.lock);
+    return proven;
+}
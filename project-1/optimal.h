@@ -0,0 +1,116 @@
+/* * * * * * * *  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Description : Module for finding the least makespan a plan can have, by  *
+ *               branch and bound over which cpu each job goes to, subtrees *
+ *               shared out between threads that steal from each other      *
+ * Layout by :  Matt Farrugia <matt.farrugia@unimelb.edu.au>                *
+ * Created by :Syed Ahammad Newaz Saif                                      *
+ * Email : snewaz@student.unimelb.edu.au                                    *
+ * Student ID : 684933                                                      *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * * */
+
+#ifndef OPTIMAL_H
+#define OPTIMAL_H
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include "plan.h"
+
+/* Jobs branched on before the rest of a subtree is searched by the thread
+   that has it, each choice above that a subtree other threads can steal. */
+#define SPLIT_DEPTH 4
+
+/* Steps of work, each a node or a job looked at, between looks at the
+   clock. */
+#define CLOCK_INTERVAL 4096
+
+/* Jobs a cpu has room for before it grows. */
+#define INITIAL_SEARCH_JOBS 8
+
+/* * * * * * * * * * *
+ * TYPE DEFINITIONS  *
+ * * * * * * * * * * */
+
+typedef struct subtree Subtree;
+typedef struct deque Deque;
+typedef struct searchcpu SearchCpu;
+typedef struct searcher Searcher;
+typedef struct search Search;
+
+/* * * * * * * * * *
+ * DATA STRUCTURES *
+ * * * * * * * * * */
+
+/* A subtree yet to be searched: the cpus chosen for the first depth jobs
+   branched on. */
+struct subtree
+{
+    int depth;
+    int *cpus;
+};
+
+/* A thread's subtrees. It takes the newest one itself and other threads
+   steal the oldest, which are the largest. */
+struct deque
+{
+    Subtree **items;
+    int head;               // oldest subtree, taken by thieves
+    int tail;               // one past the newest, taken by the owner
+    int capacity;
+    pthread_mutex_t lock;
+};
+
+/* The jobs a cpu holds partway down the tree, in the order they run. */
+struct searchcpu
+{
+    int *jobs;
+    int size;
+    int capacity;
+    long long completion;
+};
+
+/* One thread of a search and the partial plan it is working on. */
+struct searcher
+{
+    int id;
+    pthread_t thread;
+    Search *search;
+    Deque deque;
+    SearchCpu *cpus;
+    int *chosen;            // cpu chosen for each job branched on so far
+    long long nodes;
+    long long steps;        // work done since the clock was last looked at
+};
+
+/* What the threads of a search share. */
+struct search
+{
+    Plan *plan;
+    int nprocessor;
+    int *branch;            // jobs to place, longest first, in the order branched on
+    int nbranch;
+    long long bound;        // no plan can finish sooner
+    Searcher *searchers;
+    int nthreads;
+    long long deadline;     // monotonic clock in nanoseconds to give up at
+    atomic_llong best;      // makespan of the best plan found so far
+    int *bestcpus;          // cpu of every job in it, under the lock
+    pthread_mutex_t lock;
+    atomic_int outstanding; // subtrees made and not yet searched
+    atomic_int stop;        // 1 once the time is up
+};
+
+/* * * * * * * * * * * * *
+ * FUNCTION DEFINITIONS  *
+ * * * * * * * * * * * * */
+
+/* Searches for the plan of the same jobs with the least makespan, starting
+   from plan as the best so far and keeping subprocesses on their cpus.
+   Subtrees are left out once a lower bound shows they cannot do better,
+   and cpus holding the same jobs are only branched to once. Runs on
+   nthreads threads for at most budgetns nanoseconds, then replans plan as
+   the best found and stores the nodes searched in nodes.
+   Returns 1 if the best found is proven the least possible, 0 if the time
+   ran out first. */
+int optimise_plan(Plan *plan, int nthreads, long long budgetns, long long *nodes);
+
+#endif
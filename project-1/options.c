@@ -0,0 +1,348 @@
+/* * * * * * * *  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Description : Module for the options allocate is run with, read from the *
+ *               command line once and handed to whatever runs the trace    *
+ * Layout by :  Matt Farrugia <matt.farrugia@unimelb.edu.au>                *
+ * Created by :Syed Ahammad Newaz Saif                                      *
+ * Email : snewaz@student.unimelb.edu.au                                    *
+ * Student ID : 684933                                                      *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * * */
+
+/* List of libraries for the assignment */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "options.h"
+#include "sweep.h"
+
+/* Global variables that helps structure my code */
+#define MINTOTALSTDIN 4
+#define MAXTOTALSTDIN 29
+#define FILEFLAG "-f"
+#define NPROCESSOR "-p"
+#define CHALLENGE "-c"
+#define STREAM "-s"
+#define QUIET "-q"
+#define PERCENTILES "--percentiles"
+#define SWEEP "--sweep"
+#define STEAL "--steal"
+#define POLICY "--policy"
+#define GAP "--gap"
+#define EXECUTE "--execute"
+#define UNIT "--unit"
+#define DEFAULT_UNIT_US 1000
+#define THREADS "-j"
+#define OPTIMAL "--optimal"
+#define SEGMENTS "--segments"
+#define SPLIT "--split"
+#define COMPARE_SPLITS "--compare-splits"
+#define GANG "--gang"
+#define COMPARE_GANG "--compare-gang"
+#define BUDGET "--budget"
+#define DEFAULT_BUDGET_S 10
+#define NS_PER_S (1000LL * 1000 * 1000)
+
+/* Helper function that reads the flags of a single run onto options. */
+void read_run_options(int argc, char *argv[], Options *options);
+
+/* Helper function that reads the flags of a sweep onto options, exiting
+   with its usage if it cannot be run. */
+void read_sweep_options(int argc, char *argv[], Options *options);
+
+/* * * * * * * * * * * * *
+ * FUNCTION DEFINITIONS  *
+ * * * * * * * * * * * * */
+
+/* Reads the options of a run of the form
+   './allocate -f testfilepath -p n [flags ...]', or of a sweep of the form
+   './allocate --sweep -p from-to -f file [-f file ...] [-c] [-j threads]'.
+   Anything missing keeps its default: shortest remaining time first, one
+   subprocess per cpu, one thread per core and nothing optional. Exits with
+   a usage message if the options cannot be run.
+   Returns a pointer to them. */
+Options *new_options(int argc, char *argv[])
+{
+    Options *options = malloc(sizeof *options);
+    assert(options);
+
+    // room for every argument to be a file
+    options->filepaths = malloc(sizeof(char *) * argc);
+    assert(options->filepaths);
+    options->nfiles = 0;
+    options->filepath = NULL;
+    options->nprocessor = 0;
+    options->from = 0;
+    options->to = 0;
+    options->sweep = argc > 1 && strcmp(argv[1], SWEEP) == 0;
+    options->challenge = 0;
+    options->budgetns = 0;
+    options->nthreads = sweep_default_threads();
+    options->stream = 0;
+    options->quiet = 0;
+    options->percentiles = 0;
+    options->gap = 0;
+    options->stealing = 0;
+    options->policy = srtf_policy();
+    options->split = all_split();
+    options->comparesplits = 0;
+    options->gang = 0;
+    options->comparegang = 0;
+    options->segmentpath = NULL;
+    options->unitus = 0;
+
+    if (options->sweep)
+    {
+        read_sweep_options(argc, argv, options);
+    }
+    else
+    {
+        read_run_options(argc, argv, options);
+    }
+    return options;
+}
+
+/* Destroys options and their associated memory. */
+void free_options(Options *options)
+{
+    assert(options != NULL);
+    free(options->filepaths);
+    free(options);
+}
+
+/* Reads from stdin in the form :
+   './allocate (executeable main) -f testfilepath -p n (number of processes)'.
+   An optional  '-c' plans the whole trace ahead to reduce the makespan instead.
+   An optional '--optimal' plans it too, then searches for the least makespan
+   possible for up to 10 seconds, or as long as '--budget seconds' gives it,
+   on one thread per core unless '-j threads' says otherwise.
+   An optional '-s' streams the processes in from the file as they arrive.
+   An optional '-q' prints only the statistics, none of the events.
+   An optional '--percentiles' adds the tail of the statistics.
+   An optional '--steal' lets idle cpus take work waiting on other cpus.
+   An optional '--gap' adds how far the run is at most from the best possible.
+   An optional '--segments file' writes out what ran on each cpu and when,
+   one 'cpu,pid,start,end' line per stretch a process ran without a switch.
+   An optional '--policy name' schedules by 'srtf' (the default), 'fcfs',
+   'rr' or 'mlfq', the last two taking a quantum as in 'rr:5'.
+   An optional '--split name' splits parallelisable processes by 'all' (one
+   subprocess per cpu, the default), 'fixed:k', 'work' or 'cost', and an
+   optional '--compare-splits' adds how the run does under each of them.
+   An optional '--gang' runs the subprocesses of a process together, each on
+   a different cpu, and an optional '--compare-gang' adds how long the split
+   processes take that way compared with running the subprocesses
+   independently.
+   An optional '--execute' runs the processes for real as busy work and gives
+   the makespan measured next to the one simulated, a unit of time taking
+   1000 microseconds unless '--unit us' says otherwise.
+   The file may be a text trace or a binary one made by
+   './allocate --convert in.txt out.bin'.
+   The -f and -p flag can come in any order. Flags only a simulation has a
+   use for cannot be given with '-c', '--optimal' or '--execute', and
+   '--execute' cannot be given with '-c' or '--optimal' either. */
+void read_run_options(int argc, char *argv[], Options *options)
+{
+    const char *simulating = NULL; // the last flag given only a simulation uses
+    int executing = 0;
+    long long unitus = 0;           // as given by '--unit', 0 if not
+
+    if (argc <= MINTOTALSTDIN || argc >= MAXTOTALSTDIN)
+    {
+        // incorrect reading from stdin exception
+        fprintf(stderr, "Not enough arguments are present : Expected atleast 4 (inclusive of challenge flag)!\n");
+        exit(EXIT_FAILURE);
+    }
+
+    for (int argument = 1; argument < argc; argument++)
+    {
+        int hasvalue = argument + 1 < argc;
+        // check '-f' flag (any order)
+        if (strcmp(argv[argument], FILEFLAG) == 0 && hasvalue)
+        {
+            // store the filepath
+            options->filepath = argv[++argument];
+            options->filepaths[options->nfiles++] = options->filepath;
+        }
+        else if (strcmp(argv[argument], NPROCESSOR) == 0 && hasvalue)
+        {
+            // check for '-p' flag (any order), convert to integer
+            options->nprocessor = atoi(argv[++argument]);
+        }
+        else if (strcmp(argv[argument], CHALLENGE) == 0)
+        {
+            // if the own scheduling algorithm prompted by '-c' works
+            options->challenge = 1;
+        }
+        else if (strcmp(argv[argument], OPTIMAL) == 0)
+        {
+            // plan as for the challenge, then search for the best plan
+            options->challenge = 1;
+            options->budgetns = (options->budgetns > 0) ? options->budgetns : DEFAULT_BUDGET_S * NS_PER_S;
+        }
+        else if (strcmp(argv[argument], BUDGET) == 0 && hasvalue)
+        {
+            // seconds the search may take before settling for the best found
+            options->challenge = 1;
+            options->budgetns = (long long)(atof(argv[++argument]) * NS_PER_S);
+        }
+        else if (strcmp(argv[argument], THREADS) == 0 && hasvalue)
+        {
+            // threads to search on
+            options->nthreads = atoi(argv[++argument]);
+        }
+        else if (strcmp(argv[argument], STREAM) == 0)
+        {
+            // read the processes lazily instead of all at once
+            options->stream = 1;
+        }
+        else if (strcmp(argv[argument], QUIET) == 0)
+        {
+            // leave out the running and finished lines
+            options->quiet = 1;
+        }
+        else if (strcmp(argv[argument], PERCENTILES) == 0)
+        {
+            // report percentiles as well as averages
+            options->percentiles = 1;
+        }
+        else if (strcmp(argv[argument], GAP) == 0)
+        {
+            // compare the run with lower bounds on the best possible
+            options->gap = 1;
+        }
+        else if (strcmp(argv[argument], SEGMENTS) == 0 && hasvalue)
+        {
+            // log the run segments to a file
+            simulating = argv[argument];
+            options->segmentpath = argv[++argument];
+        }
+        else if (strcmp(argv[argument], STEAL) == 0)
+        {
+            // idle cpus take over waiting work
+            simulating = argv[argument];
+            options->stealing = 1;
+        }
+        else if (strcmp(argv[argument], POLICY) == 0 && hasvalue)
+        {
+            // schedule by another policy than shortest remaining time first
+            simulating = argv[argument];
+            if (!find_policy(argv[++argument], &options->policy))
+            {
+                fprintf(stderr, "Unknown policy %s : Expected srtf, fcfs, rr[:quantum] or mlfq[:quantum]\n", argv[argument]);
+                exit(EXIT_FAILURE);
+            }
+        }
+        else if (strcmp(argv[argument], SPLIT) == 0 && hasvalue)
+        {
+            // split parallelisable processes into other than one per cpu
+            simulating = argv[argument];
+            if (!find_split(argv[++argument], &options->split))
+            {
+                fprintf(stderr, "Unknown split %s : Expected all, fixed:k, work or cost\n", argv[argument]);
+                exit(EXIT_FAILURE);
+            }
+        }
+        else if (strcmp(argv[argument], GANG) == 0)
+        {
+            // co-schedule the subprocesses of each process
+            simulating = argv[argument];
+            options->gang = 1;
+        }
+        else if (strcmp(argv[argument], COMPARE_GANG) == 0)
+        {
+            // rerun with and without gang to compare
+            simulating = argv[argument];
+            options->comparegang = 1;
+        }
+        else if (strcmp(argv[argument], COMPARE_SPLITS) == 0)
+        {
+            // rerun under every split to compare
+            simulating = argv[argument];
+            options->comparesplits = 1;
+        }
+        else if (strcmp(argv[argument], EXECUTE) == 0)
+        {
+            // run for real as well as simulate
+            executing = 1;
+        }
+        else if (strcmp(argv[argument], UNIT) == 0 && hasvalue)
+        {
+            // microseconds of real work per unit of execution time
+            unitus = atoll(argv[++argument]);
+            if (unitus < 1)
+            {
+                fprintf(stderr, "Usage : --unit %s must be at least 1 microsecond\n", argv[argument]);
+                exit(EXIT_FAILURE);
+            }
+        }
+    }
+
+    if (unitus > 0 && !executing)
+    {
+        fprintf(stderr, "Usage : --unit only has a use with --execute\n");
+        exit(EXIT_FAILURE);
+    }
+    if (executing)
+    {
+        options->unitus = (unitus > 0) ? unitus : DEFAULT_UNIT_US;
+    }
+
+    if (options->nthreads < 1)
+    {
+        fprintf(stderr, "Usage : -j %d must be at least 1 thread to search on\n", options->nthreads);
+        exit(EXIT_FAILURE);
+    }
+
+    // a plan runs the trace its own way, so would quietly ignore them
+    if (options->challenge && simulating != NULL)
+    {
+        fprintf(stderr, "Usage : %s cannot be used with -c, --optimal or --budget, which plan the trace instead of simulating it\n", simulating);
+        exit(EXIT_FAILURE);
+    }
+
+    // running for real is always shortest remaining time first, one
+    // subprocess per cpu, so would quietly ignore these too
+    if (executing && (simulating != NULL || options->challenge))
+    {
+        fprintf(stderr, "Usage : %s cannot be used with --execute, which runs the trace by srtf with one subprocess per cpu\n",
+            (simulating != NULL) ? simulating : "-c, --optimal or --budget");
+        exit(EXIT_FAILURE);
+    }
+}
+
+/* Reads a sweep from stdin in the form :
+   './allocate --sweep -p from-to -f file [-f file ...] [-c] [-j threads]'.
+   Every file is paired with every number of processors in the range, and
+   with '-c' each pairing is run again planned for the challenge. The
+   sweep runs on one thread per core unless '-j' says otherwise. */
+void read_sweep_options(int argc, char *argv[], Options *options)
+{
+    int ranged = 0;
+    for (int argument = 2; argument < argc; argument++)
+    {
+        // every flag but '-c' takes a value
+        int hasvalue = argument + 1 < argc;
+        if (strcmp(argv[argument], FILEFLAG) == 0 && hasvalue)
+        {
+            options->filepath = argv[++argument];
+            options->filepaths[options->nfiles++] = options->filepath;
+        }
+        else if (strcmp(argv[argument], NPROCESSOR) == 0 && hasvalue)
+        {
+            ranged = parse_processor_range(argv[++argument], &options->from, &options->to);
+        }
+        else if (strcmp(argv[argument], THREADS) == 0 && hasvalue)
+        {
+            options->nthreads = atoi(argv[++argument]);
+        }
+        else if (strcmp(argv[argument], CHALLENGE) == 0)
+        {
+            options->challenge = 1;
+        }
+    }
+
+    if (options->nfiles == 0 || !ranged || options->nthreads < 1)
+    {
+        fprintf(stderr, "Usage : ./allocate --sweep -p from-to -f file [-f file ...] [-c] [-j threads]\n");
+        exit(EXIT_FAILURE);
+    }
+}
@@ -0,0 +1,71 @@
+/* * * * * * * *  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Description : Module for the options allocate is run with, read from the *
+ *               command line once and handed to whatever runs the trace    *
+ * Layout by :  Matt Farrugia <matt.farrugia@unimelb.edu.au>                *
+ * Created by :Syed Ahammad Newaz Saif                                      *
+ * Email : snewaz@student.unimelb.edu.au                                    *
+ * Student ID : 684933                                                      *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * * */
+
+#ifndef OPTIONS_H
+#define OPTIONS_H
+
+#include "policy.h"
+#include "split.h"
+
+/* * * * * * * * * * *
+ * TYPE DEFINITIONS  *
+ * * * * * * * * * * */
+
+typedef struct options Options;
+
+/* * * * * * * * * *
+ * DATA STRUCTURES *
+ * * * * * * * * * */
+
+/* Everything given on the command line. A single run uses the last file
+   given and nprocessor, a sweep every file and each number of processors
+   from to to. */
+struct options
+{
+    char **filepaths;
+    int nfiles;
+    char *filepath;         // the last of filepaths, NULL if none
+    int nprocessor;
+    int from;               // the range of processors of a sweep
+    int to;
+    int sweep;
+    int challenge;          // 1 to plan for the least makespan instead of simulating
+    long long budgetns;     // time to search the plan for, 0 not to
+    int nthreads;
+    int stream;
+    int quiet;
+    int percentiles;
+    int gap;
+    int stealing;
+    Policy policy;
+    Split split;
+    int comparesplits;
+    int gang;
+    int comparegang;
+    char *segmentpath;      // NULL unless the segments are written out
+    long long unitus;       // microseconds per unit of real work, 0 not to run for real
+};
+
+/* * * * * * * * * * * * *
+ * FUNCTION DEFINITIONS  *
+ * * * * * * * * * * * * */
+
+/* Reads the options of a run of the form
+   './allocate -f testfilepath -p n [flags ...]', or of a sweep of the form
+   './allocate --sweep -p from-to -f file [-f file ...] [-c] [-j threads]'.
+   Anything missing keeps its default: shortest remaining time first, one
+   subprocess per cpu, one thread per core and nothing optional. Exits with
+   a usage message if the options cannot be run.
+   Returns a pointer to them. */
+Options *new_options(int argc, char *argv[]);
+
+/* Destroys options and their associated memory. */
+void free_options(Options *options);
+
+#endif
@@ -0,0 +1,166 @@
+/* * * * * * * *  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Description : Module for writing the lines of the simulation out through *
+ *               a large buffer with integers formatted by hand             *
+ * Layout by :  Matt Farrugia <matt.farrugia@unimelb.edu.au>                *
+ * Created by :Syed Ahammad Newaz Saif                                      *
+ * Email : snewaz@student.unimelb.edu.au                                    *
+ * Student ID : 684933                                                      *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * * */
+
+/* List of libraries for the assignment */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <pthread.h>
+#include "output.h"
+
+/* Bytes buffered before they are written out. Well above the longest line
+   so a line never needs more than one flush. */
+#define BUFFER_SIZE (1 << 20)
+#define LINE_SLACK 64
+
+/* Outputs still open, written out at exit. The only state shared between
+   simulations, so it is kept under a lock. */
+static Output *open_outputs = NULL;
+static pthread_mutex_t open_outputs_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* Helper function that writes out every output still open at exit. */
+void flush_open_outputs();
+
+/* Helper function that makes sure there is room for length more bytes. */
+void output_reserve(Output *output, int length);
+
+/* * * * * * * * * * * * *
+ * FUNCTION DEFINITIONS  *
+ * * * * * * * * * * * * */
+
+/* Creates a new output writing to file and returns a pointer to it. */
+Output *new_output(FILE *file)
+{
+    static int registered = 0;
+    assert(file != NULL);
+    Output *output = malloc(sizeof *output);
+    assert(output);
+
+    output->file = file;
+    output->buffer = malloc(BUFFER_SIZE);
+    assert(output->buffer);
+    output->used = 0;
+    output->capacity = BUFFER_SIZE;
+
+    // keep track of it in case the program exits before it is freed
+    pthread_mutex_lock(&open_outputs_lock);
+    if (!registered)
+    {
+        atexit(flush_open_outputs);
+        registered = 1;
+    }
+    output->next = open_outputs;
+    open_outputs = output;
+    pthread_mutex_unlock(&open_outputs_lock);
+
+    return output;
+}
+
+/* Writes out whatever is buffered and destroys the output. */
+void free_output(Output *output)
+{
+    assert(output != NULL);
+    output_flush(output);
+
+    // take it off the outputs still open
+    pthread_mutex_lock(&open_outputs_lock);
+    Output **link = &open_outputs;
+    while (*link != output)
+    {
+        link = &(*link)->next;
+    }
+    *link = output->next;
+    pthread_mutex_unlock(&open_outputs_lock);
+
+    free(output->buffer);
+    free(output);
+}
+
+/* Writes out whatever is buffered to the file. */
+void output_flush(Output *output)
+{
+    assert(output != NULL);
+    if (output->used > 0)
+    {
+        fwrite(output->buffer, 1, output->used, output->file);
+        output->used = 0;
+    }
+    fflush(output->file);
+}
+
+/* Helper function that writes out every output still open at exit. */
+void flush_open_outputs()
+{
+    pthread_mutex_lock(&open_outputs_lock);
+    for (Output *output = open_outputs; output != NULL; output = output->next)
+    {
+        output_flush(output);
+    }
+    pthread_mutex_unlock(&open_outputs_lock);
+}
+
+/* Helper function that makes sure there is room for length more bytes. */
+void output_reserve(Output *output, int length)
+{
+    if (output->used + length > output->capacity)
+    {
+        output_flush(output);
+    }
+    assert(length <= output->capacity);
+}
+
+/* Appends a string. */
+void output_string(Output *output, const char *string)
+{
+    int length = strlen(string);
+    output_reserve(output, length);
+    memcpy(output->buffer + output->used, string, length);
+    output->used += length;
+}
+
+/* Appends an integer in decimal. */
+void output_integer(Output *output, long long value)
+{
+    char digits[LINE_SLACK];
+    int count = 0;
+    // go unsigned so the most negative value still has a magnitude
+    unsigned long long magnitude = (value < 0) ? -(unsigned long long)value : (unsigned long long)value;
+
+    // digits come out least significant first
+    do
+    {
+        digits[count++] = '0' + magnitude % 10;
+        magnitude /= 10;
+    } while (magnitude > 0);
+
+    output_reserve(output, count + 1);
+    if (value < 0)
+    {
+        output->buffer[output->used++] = '-';
+    }
+    while (count > 0)
+    {
+        output->buffer[output->used++] = digits[--count];
+    }
+}
+
+/* Appends a processid as a whole number, or for a subprocess followed by
+   a point and which subprocess it is, the same as printf's "%d" and
+   "%d.%d" would. */
+void output_processid(Output *output, int processid, int child, int subprocess)
+{
+    output_integer(output, processid);
+    if (subprocess)
+    {
+        output_reserve(output, 1);
+        output->buffer[output->used++] = '.';
+        output_integer(output, child);
+    }
+}
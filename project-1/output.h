@@ -0,0 +1,60 @@
+/* * * * * * * *  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Description : Module for writing the lines of the simulation out through *
+ *               a large buffer with integers formatted by hand             *
+ * Layout by :  Matt Farrugia <matt.farrugia@unimelb.edu.au>                *
+ * Created by :Syed Ahammad Newaz Saif                                      *
+ * Email : snewaz@student.unimelb.edu.au                                    *
+ * Student ID : 684933                                                      *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * * */
+
+#ifndef OUTPUT_H
+#define OUTPUT_H
+
+#include <stdio.h>
+
+/* * * * * * * * * * *
+ * TYPE DEFINITIONS  *
+ * * * * * * * * * * */
+
+typedef struct output Output;
+
+/* * * * * * * * * *
+ * DATA STRUCTURES *
+ * * * * * * * * * */
+
+/* Text waiting to be written to file. Every output still open is on a list
+   so whatever is buffered gets written even if the program exits early. */
+struct output
+{
+    FILE *file;
+    char *buffer;
+    int used;
+    int capacity;
+    Output *next;   // the next output still open
+};
+
+/* * * * * * * * * * * * *
+ * FUNCTION DEFINITIONS  *
+ * * * * * * * * * * * * */
+
+/* Creates a new output writing to file and returns a pointer to it. */
+Output *new_output(FILE *file);
+
+/* Writes out whatever is buffered and destroys the output. */
+void free_output(Output *output);
+
+/* Writes out whatever is buffered to the file. */
+void output_flush(Output *output);
+
+/* Appends a string. */
+void output_string(Output *output, const char *string);
+
+/* Appends an integer in decimal. */
+void output_integer(Output *output, long long value);
+
+/* Appends a processid as a whole number, or for a subprocess followed by
+   a point and which subprocess it is, the same as printf's "%d" and
+   "%d.%d" would. */
+void output_processid(Output *output, int processid, int child, int subprocess);
+
+#endif
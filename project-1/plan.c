@@ -0,0 +1,713 @@
+/* * * * * * * *  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Description : Module for planning a whole trace ahead of time to finish  *
+ *               it as early as possible, by longest processing time first  *
+ *               placement improved by moving and swapping between cpus     *
+ * Layout by :  Matt Farrugia <matt.farrugia@unimelb.edu.au>                *
+ * Created by :Syed Ahammad Newaz Saif                                      *
+ * Email : snewaz@student.unimelb.edu.au                                    *
+ * Student ID : 684933                                                      *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * * */
+
+/* List of libraries for the assignment */
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <assert.h>
+#include "heap.h"
+#include "loadtree.h"
+#include "plan.h"
+
+/* Initial number of jobs a cpu has room for. */
+#define INITIAL_JOBS 16
+
+/* A job starting or a whole process finishing, as plan_run reports it. */
+typedef struct planevent
+{
+    long long time;
+    int finishing;  // 1 for a process finishing, which comes before starts
+    int cpu;
+    int index;      // the job starting, or the process finishing
+} PlanEvent;
+
+/* Helper function that orders jobs by arrival time, then longest first,
+   then by processid. */
+int compare_arrival_longest(const void *a, const void *b);
+
+/* Helper function that returns whether data a is longer than data b, the
+   lower processid on a tie. */
+int longest_first(const Data *a, const Data *b);
+
+/* Helper function that orders jobs by the cpu they are planned on, then in
+   the order they run there. */
+int compare_planned(const void *a, const void *b);
+
+/* Helper function that orders arrival times, earliest first. */
+int compare_arrival(const void *a, const void *b);
+
+/* Helper function that orders events by time, processes finishing before
+   jobs start, then by cpu. */
+int compare_events(const void *a, const void *b);
+
+/* Helper function that lays out each cpu's jobs in the order they run, by
+   the cpu each job is planned on. */
+void plan_layout(Plan *plan);
+
+/* Helper function that frees the layout of each cpu's jobs. */
+void plan_unlayout(Plan *plan);
+
+/* Helper function that recalculates the running times of a cpu's jobs. */
+void cpuplan_refresh(Plan *plan, int cpu);
+
+/* Helper function that places a job on a cpu in the order it runs. */
+void cpuplan_insert(Plan *plan, int cpu, int job);
+
+/* Helper function that takes the job at position off a cpu. */
+void cpuplan_remove(Plan *plan, int cpu, int position);
+
+/* Helper function that returns the position of job on a cpu, or where it
+   would go. O(log n). */
+int cpuplan_position(Plan *plan, int cpu, int job);
+
+/* Helper function that returns when a cpu finishes its jobs. O(1). */
+long long completion(Plan *plan, int cpu);
+
+/* Helper function that returns when a cpu would finish without the job at
+   position. O(1). */
+long long completion_without(Plan *plan, int cpu, int position);
+
+/* Helper function that returns when a cpu would finish with job as well.
+   O(log n). */
+long long completion_with(Plan *plan, int cpu, int job);
+
+/* Helper function that returns when a cpu would finish with job in place
+   of the job at position. O(n). */
+long long completion_swapped(Plan *plan, int cpu, int position, int job);
+
+/* Helper function that moves a job off the cpu critical to another cpu if
+   that finishes both earlier. Returns 1 if a job moved. */
+int try_move(Plan *plan, int critical, long long *steps);
+
+/* Helper function that swaps a job of the cpu critical with a job of
+   another cpu if that finishes both earlier. Returns 1 if jobs swapped. */
+int try_swap(Plan *plan, int critical, long long *steps, long long budget);
+
+/* * * * * * * * * * * * *
+ * FUNCTION DEFINITIONS  *
+ * * * * * * * * * * * * */
+
+/* Helper function that orders jobs by arrival time, then longest first,
+   then by processid. */
+int compare_arrival_longest(const void *a, const void *b)
+{
+    const Job *first = a;
+    const Job *second = b;
+    if (first->arrivaltime != second->arrivaltime)
+    {
+        return (first->arrivaltime > second->arrivaltime) ? 1 : -1;
+    }
+    return longest_first(&second->data, &first->data) - longest_first(&first->data, &second->data);
+}
+
+/* Helper function that returns whether data a is longer than data b, the
+   lower processid on a tie. */
+int longest_first(const Data *a, const Data *b)
+{
+    if (a->remainingtime != b->remainingtime)
+    {
+        return a->remainingtime > b->remainingtime;
+    }
+    return processid_before(a, b);
+}
+
+/* Helper function that orders jobs by the cpu they are planned on, then in
+   the order they run there. */
+int compare_planned(const void *a, const void *b)
+{
+    const Job *first = a;
+    const Job *second = b;
+    if (first->cpu != second->cpu)
+    {
+        return first->cpu - second->cpu;
+    }
+    return job_runs_before(second, first) - job_runs_before(first, second);
+}
+
+/* Helper function that orders arrival times, earliest first. */
+int compare_arrival(const void *a, const void *b)
+{
+    long long first = *(const long long *)a;
+    long long second = *(const long long *)b;
+    return (first > second) - (first < second);
+}
+
+/* Helper function that orders events by time, processes finishing before
+   jobs start, then by cpu. */
+int compare_events(const void *a, const void *b)
+{
+    const PlanEvent *first = a;
+    const PlanEvent *second = b;
+    if (first->time != second->time)
+    {
+        return (first->time > second->time) ? 1 : -1;
+    }
+    if (first->finishing != second->finishing)
+    {
+        return second->finishing - first->finishing;
+    }
+    return first->cpu - second->cpu;
+}
+
+/* Returns whether job a runs before job b on a cpu: by arrival time, then
+   shortest first, then by processid. */
+int job_runs_before(const Job *a, const Job *b)
+{
+    if (a->arrivaltime != b->arrivaltime)
+    {
+        return a->arrivaltime < b->arrivaltime;
+    }
+    return shortest_first(&a->data, &b->data);
+}
+
+/* Creates a plan for every process of trace on nprocessor cpus.
+   Parallelisable processes are split as the simulator splits them, the
+   k-th subprocess on cpu k, and the rest placed longest processing time
+   first: whenever a cpu comes free it takes the longest job arrived by
+   then. O(n log n).
+   Returns a pointer to it. */
+Plan *new_plan(Trace *trace, int nprocessor)
+{
+    assert(trace != NULL && trace->file == NULL && nprocessor >= 1);
+    Plan *plan = malloc(sizeof *plan);
+    assert(plan);
+    plan->nprocessor = nprocessor;
+    plan->trace = trace;
+
+    // count the jobs, every subprocess being one
+    int njobs = 0;
+    Process *process;
+    for (int i = 0; (process = trace_peek(trace, i)) != NULL; i++)
+    {
+        njobs += (process->parallelisable == 'p') ? nprocessor : 1;
+    }
+    plan->njobs = njobs;
+    plan->jobs = malloc(sizeof(Job) * (njobs > 0 ? njobs : 1));
+    assert(plan->jobs);
+
+    Data *dataarray = malloc(sizeof(Data) * nprocessor);
+    assert(dataarray);
+    int j = 0;
+    for (int i = 0; (process = trace_peek(trace, i)) != NULL; i++)
+    {
+        Data newdata;
+        newdata.remainingtime = process->executiontime;
+        newdata.sequence = 0;
+        newdata.used = 0;
+        newdata.level = 0;
+        newdata.process = i;
+        newdata.processid = process->processid;
+        newdata.child = 0;
+        newdata.parallelisable = process->parallelisable;
+        if (process->parallelisable == 'p')
+        {
+            create_subprocess(dataarray, newdata, process->executiontime, nprocessor);
+            for (int k = 0; k < nprocessor; k++)
+            {
+                Job job = {dataarray[k], process->arrivaltime, 1, k};
+                plan->jobs[j++] = job;
+            }
+        }
+        else
+        {
+            Job job = {newdata, process->arrivaltime, 0, 0};
+            plan->jobs[j++] = job;
+        }
+    }
+    free(dataarray);
+
+    // longest processing time first: whenever a cpu comes free it takes the
+    // longest job arrived by then, subprocesses going straight to their cpu
+    qsort(plan->jobs, njobs, sizeof(Job), compare_arrival_longest);
+    LoadTree *free_at = new_loadtree(nprocessor); // when each cpu comes free
+    Heap *arrived = new_heap_ordered(longest_first);
+    int next = 0;
+    while (next < njobs || heap_size(arrived) > 0)
+    {
+        long long time = loadtree_load(free_at, loadtree_min(free_at));
+        if (heap_size(arrived) == 0 && plan->jobs[next].arrivaltime > time)
+        {
+            // nothing to do until the next job arrives
+            time = plan->jobs[next].arrivaltime;
+        }
+        while (next < njobs && plan->jobs[next].arrivaltime <= time)
+        {
+            Job *job = &plan->jobs[next];
+            if (job->pinned)
+            {
+                long long start = loadtree_load(free_at, job->cpu);
+                start = (start > job->arrivaltime) ? start : job->arrivaltime;
+                loadtree_add(free_at, job->cpu, start + job->data.remainingtime - loadtree_load(free_at, job->cpu));
+            }
+            else
+            {
+                // the job's place in the array rides along in its sequence
+                Data data = job->data;
+                data.sequence = next;
+                heap_insert(arrived, data);
+            }
+            next++;
+        }
+        if (heap_size(arrived) > 0)
+        {
+            Job *job = &plan->jobs[heap_remove_min(arrived).sequence];
+            job->cpu = loadtree_min(free_at);
+            long long start = loadtree_load(free_at, job->cpu);
+            start = (start > job->arrivaltime) ? start : job->arrivaltime;
+            loadtree_add(free_at, job->cpu, start + job->data.remainingtime - loadtree_load(free_at, job->cpu));
+        }
+    }
+    free_heap(arrived);
+    free_loadtree(free_at);
+
+    plan_layout(plan);
+    return plan;
+}
+
+/* Helper function that lays out each cpu's jobs in the order they run, by
+   the cpu each job is planned on. */
+void plan_layout(Plan *plan)
+{
+    // each cpu's jobs then lie together in the order they run
+    qsort(plan->jobs, plan->njobs, sizeof(Job), compare_planned);
+    plan->cpus = malloc(sizeof(CpuPlan) * plan->nprocessor);
+    assert(plan->cpus);
+    int next = 0;
+    for (int c = 0; c < plan->nprocessor; c++)
+    {
+        CpuPlan *cpuplan = &plan->cpus[c];
+        cpuplan->size = 0;
+        while (next + cpuplan->size < plan->njobs && plan->jobs[next + cpuplan->size].cpu == c)
+        {
+            cpuplan->size++;
+        }
+        cpuplan->capacity = (cpuplan->size > INITIAL_JOBS) ? cpuplan->size : INITIAL_JOBS;
+        cpuplan->jobs = malloc(sizeof(int) * cpuplan->capacity);
+        cpuplan->finish = malloc(sizeof(long long) * cpuplan->capacity);
+        cpuplan->rest = malloc(sizeof(long long) * (cpuplan->capacity + 1));
+        cpuplan->tail = malloc(sizeof(long long) * (cpuplan->capacity + 1));
+        assert(cpuplan->jobs && cpuplan->finish && cpuplan->rest && cpuplan->tail);
+        for (int i = 0; i < cpuplan->size; i++)
+        {
+            cpuplan->jobs[i] = next + i;
+        }
+        next += cpuplan->size;
+        cpuplan_refresh(plan, c);
+    }
+}
+
+/* Helper function that frees the layout of each cpu's jobs. */
+void plan_unlayout(Plan *plan)
+{
+    for (int c = 0; c < plan->nprocessor; c++)
+    {
+        free(plan->cpus[c].jobs);
+        free(plan->cpus[c].finish);
+        free(plan->cpus[c].rest);
+        free(plan->cpus[c].tail);
+    }
+    free(plan->cpus);
+}
+
+/* Destroys a plan and its associated memory, but not its trace. */
+void free_plan(Plan *plan)
+{
+    assert(plan != NULL);
+    plan_unlayout(plan);
+    free(plan->jobs);
+    free(plan);
+}
+
+/* Replans every job onto cpus[job], which must keep each subprocess on
+   its own cpu. The jobs may be reordered. */
+void plan_assign(Plan *plan, const int *cpus)
+{
+    assert(plan != NULL && cpus != NULL);
+    for (int j = 0; j < plan->njobs; j++)
+    {
+        assert(!plan->jobs[j].pinned || plan->jobs[j].cpu == cpus[j]);
+        plan->jobs[j].cpu = cpus[j];
+    }
+    plan_unlayout(plan);
+    plan_layout(plan);
+}
+
+/* Helper function that recalculates the running times of a cpu's jobs. */
+void cpuplan_refresh(Plan *plan, int cpu)
+{
+    CpuPlan *cpuplan = &plan->cpus[cpu];
+    long long time = 0;
+    for (int i = 0; i < cpuplan->size; i++)
+    {
+        Job *job = &plan->jobs[cpuplan->jobs[i]];
+        // a cpu waits for a job to arrive only if it has nothing else
+        time = (time > job->arrivaltime ? time : job->arrivaltime) + job->data.remainingtime;
+        cpuplan->finish[i] = time;
+    }
+
+    cpuplan->rest[cpuplan->size] = 0;
+    cpuplan->tail[cpuplan->size] = LLONG_MIN;
+    for (int i = cpuplan->size - 1; i >= 0; i--)
+    {
+        Job *job = &plan->jobs[cpuplan->jobs[i]];
+        cpuplan->rest[i] = cpuplan->rest[i + 1] + job->data.remainingtime;
+        long long after = job->arrivaltime + cpuplan->rest[i];
+        cpuplan->tail[i] = (cpuplan->tail[i + 1] > after) ? cpuplan->tail[i + 1] : after;
+    }
+}
+
+/* Helper function that returns the position of job on a cpu, or where it
+   would go. O(log n). */
+int cpuplan_position(Plan *plan, int cpu, int job)
+{
+    CpuPlan *cpuplan = &plan->cpus[cpu];
+    int low = 0;
+    int high = cpuplan->size;
+    // the first job that does not run before it
+    while (low < high)
+    {
+        int mid = low + (high - low) / 2;
+        if (job_runs_before(&plan->jobs[cpuplan->jobs[mid]], &plan->jobs[job]))
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+/* Helper function that places a job on a cpu in the order it runs. */
+void cpuplan_insert(Plan *plan, int cpu, int job)
+{
+    CpuPlan *cpuplan = &plan->cpus[cpu];
+    if (cpuplan->size == cpuplan->capacity)
+    {
+        cpuplan->capacity *= 2;
+        cpuplan->jobs = realloc(cpuplan->jobs, sizeof(int) * cpuplan->capacity);
+        cpuplan->finish = realloc(cpuplan->finish, sizeof(long long) * cpuplan->capacity);
+        cpuplan->rest = realloc(cpuplan->rest, sizeof(long long) * (cpuplan->capacity + 1));
+        cpuplan->tail = realloc(cpuplan->tail, sizeof(long long) * (cpuplan->capacity + 1));
+        assert(cpuplan->jobs && cpuplan->finish && cpuplan->rest && cpuplan->tail);
+    }
+    int position = cpuplan_position(plan, cpu, job);
+    memmove(&cpuplan->jobs[position + 1], &cpuplan->jobs[position], sizeof(int) * (cpuplan->size - position));
+    cpuplan->jobs[position] = job;
+    cpuplan->size++;
+    plan->jobs[job].cpu = cpu;
+    cpuplan_refresh(plan, cpu);
+}
+
+/* Helper function that takes the job at position off a cpu. */
+void cpuplan_remove(Plan *plan, int cpu, int position)
+{
+    CpuPlan *cpuplan = &plan->cpus[cpu];
+    assert(position >= 0 && position < cpuplan->size);
+    memmove(&cpuplan->jobs[position], &cpuplan->jobs[position + 1], sizeof(int) * (cpuplan->size - position - 1));
+    cpuplan->size--;
+    cpuplan_refresh(plan, cpu);
+}
+
+/* Helper function that returns when a cpu finishes its jobs. O(1). */
+long long completion(Plan *plan, int cpu)
+{
+    CpuPlan *cpuplan = &plan->cpus[cpu];
+    return (cpuplan->size > 0) ? cpuplan->finish[cpuplan->size - 1] : 0;
+}
+
+/* Helper function that returns when a cpu would finish without the job at
+   position. O(1). */
+long long completion_without(Plan *plan, int cpu, int position)
+{
+    CpuPlan *cpuplan = &plan->cpus[cpu];
+    long long time = (position > 0) ? cpuplan->finish[position - 1] : 0;
+    // the jobs after it run from when the ones before it are done
+    long long end = time + cpuplan->rest[position + 1];
+    return (end > cpuplan->tail[position + 1]) ? end : cpuplan->tail[position + 1];
+}
+
+/* Helper function that returns when a cpu would finish with job as well.
+   O(log n). */
+long long completion_with(Plan *plan, int cpu, int job)
+{
+    CpuPlan *cpuplan = &plan->cpus[cpu];
+    Job *added = &plan->jobs[job];
+    int position = cpuplan_position(plan, cpu, job);
+    long long time = (position > 0) ? cpuplan->finish[position - 1] : 0;
+    time = (time > added->arrivaltime ? time : added->arrivaltime) + added->data.remainingtime;
+    long long end = time + cpuplan->rest[position];
+    return (end > cpuplan->tail[position]) ? end : cpuplan->tail[position];
+}
+
+/* Helper function that returns when a cpu would finish with job in place
+   of the job at position. O(n). */
+long long completion_swapped(Plan *plan, int cpu, int position, int job)
+{
+    CpuPlan *cpuplan = &plan->cpus[cpu];
+    Job *added = &plan->jobs[job];
+    int insert = cpuplan_position(plan, cpu, job);
+    long long time = 0;
+    for (int i = 0; i <= cpuplan->size; i++)
+    {
+        // the new job goes in just before the job at insert
+        if (i == insert)
+        {
+            time = (time > added->arrivaltime ? time : added->arrivaltime) + added->data.remainingtime;
+        }
+        if (i == cpuplan->size || i == position)
+        {
+            continue;
+        }
+        Job *current = &plan->jobs[cpuplan->jobs[i]];
+        time = (time > current->arrivaltime ? time : current->arrivaltime) + current->data.remainingtime;
+    }
+    return time;
+}
+
+/* Helper function that moves a job off the cpu critical to another cpu if
+   that finishes both earlier. Returns 1 if a job moved. */
+int try_move(Plan *plan, int critical, long long *steps)
+{
+    CpuPlan *cpuplan = &plan->cpus[critical];
+    long long makespan = completion(plan, critical);
+    for (int q = 0; q < cpuplan->size; q++)
+    {
+        int job = cpuplan->jobs[q];
+        (*steps)++;
+        // only jobs the cpu would finish earlier without are worth moving
+        if (plan->jobs[job].pinned || completion_without(plan, critical, q) >= makespan)
+        {
+            continue;
+        }
+        for (int c = 0; c < plan->nprocessor; c++)
+        {
+            (*steps)++;
+            if (c != critical && completion_with(plan, c, job) < makespan)
+            {
+                cpuplan_remove(plan, critical, q);
+                cpuplan_insert(plan, c, job);
+                (*steps) += cpuplan->size + plan->cpus[c].size;
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+/* Helper function that swaps a job of the cpu critical with a job of
+   another cpu if that finishes both earlier. Returns 1 if jobs swapped. */
+int try_swap(Plan *plan, int critical, long long *steps, long long budget)
+{
+    CpuPlan *cpuplan = &plan->cpus[critical];
+    long long makespan = completion(plan, critical);
+    for (int q = 0; q < cpuplan->size; q++)
+    {
+        int job = cpuplan->jobs[q];
+        if (plan->jobs[job].pinned || completion_without(plan, critical, q) >= makespan)
+        {
+            continue;
+        }
+        for (int c = 0; c < plan->nprocessor; c++)
+        {
+            CpuPlan *other = &plan->cpus[c];
+            for (int r = 0; c != critical && r < other->size; r++)
+            {
+                if (*steps >= budget)
+                {
+                    return 0;
+                }
+                int swapped = other->jobs[r];
+                (*steps)++;
+                if (plan->jobs[swapped].pinned)
+                {
+                    continue;
+                }
+
+                // the other job must fit on the critical cpu, then this one on the other
+                (*steps) += cpuplan->size;
+                if (completion_swapped(plan, critical, q, swapped) >= makespan)
+                {
+                    continue;
+                }
+                (*steps) += other->size;
+                if (completion_swapped(plan, c, r, job) >= makespan)
+                {
+                    continue;
+                }
+                cpuplan_remove(plan, critical, q);
+                cpuplan_remove(plan, c, r);
+                cpuplan_insert(plan, critical, swapped);
+                cpuplan_insert(plan, c, job);
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+/* Improves the plan by moving a job off the cpu finishing last, or swapping
+   it with a job of another cpu, while that finishes both cpus
+   earlier than it did, for at most budget steps of work.
+   Returns the number of moves and swaps made. */
+long long plan_improve(Plan *plan, long long budget)
+{
+    assert(plan != NULL);
+    long long steps = 0;
+    long long changes = 0;
+    while (steps < budget)
+    {
+        // the cpu finishing last, lowest id on a tie
+        int critical = 0;
+        for (int c = 1; c < plan->nprocessor; c++)
+        {
+            if (completion(plan, c) > completion(plan, critical))
+            {
+                critical = c;
+            }
+        }
+        steps += plan->nprocessor;
+
+        // each change finishes one cpu of the last ones earlier, so it ends
+        if (!try_move(plan, critical, &steps) && !try_swap(plan, critical, &steps, budget))
+        {
+            break;
+        }
+        changes++;
+    }
+    return changes;
+}
+
+/* Returns the time the last cpu finishes its jobs. */
+long long plan_makespan(Plan *plan)
+{
+    assert(plan != NULL);
+    long long makespan = 0;
+    for (int c = 0; c < plan->nprocessor; c++)
+    {
+        if (completion(plan, c) > makespan)
+        {
+            makespan = completion(plan, c);
+        }
+    }
+    return makespan;
+}
+
+/* Runs the plan, reporting each event to callback (unless NULL) as the
+   simulator does, and fills in the statistics of the processes in stats. */
+void plan_run(Plan *plan, SchedCallback callback, void *context, Stats *stats)
+{
+    assert(plan != NULL && stats != NULL);
+    int nprocess = plan->trace->count;
+    stats_init(stats);
+
+    // a process finishes with the last of its jobs, the highest cpu on a tie
+    long long *finish = malloc(sizeof(long long) * (nprocess > 0 ? nprocess : 1));
+    int *finishcpu = malloc(sizeof(int) * (nprocess > 0 ? nprocess : 1));
+    PlanEvent *events = malloc(sizeof(PlanEvent) * (plan->njobs + nprocess + 1));
+    assert(finish && finishcpu && events);
+    for (int i = 0; i < nprocess; i++)
+    {
+        finish[i] = -1;
+    }
+    int nevents = 0;
+    for (int c = 0; c < plan->nprocessor; c++)
+    {
+        CpuPlan *cpuplan = &plan->cpus[c];
+        for (int i = 0; i < cpuplan->size; i++)
+        {
+            Job *job = &plan->jobs[cpuplan->jobs[i]];
+            PlanEvent start = {cpuplan->finish[i] - job->data.remainingtime, 0, c, cpuplan->jobs[i]};
+            events[nevents++] = start;
+            if (cpuplan->finish[i] >= finish[job->data.process])
+            {
+                finish[job->data.process] = cpuplan->finish[i];
+                finishcpu[job->data.process] = c;
+            }
+        }
+    }
+    for (int i = 0; i < nprocess; i++)
+    {
+        PlanEvent end = {finish[i], 1, finishcpu[i], i};
+        events[nevents++] = end;
+    }
+    qsort(events, nevents, sizeof(PlanEvent), compare_events);
+
+    // processes count as remaining from the instant after they arrive, as
+    // arrivals are admitted after the processes finishing at the same time
+    long long *arrivals = malloc(sizeof(long long) * (nprocess > 0 ? nprocess : 1));
+    assert(arrivals);
+    for (int i = 0; i < nprocess; i++)
+    {
+        arrivals[i] = trace_peek(plan->trace, i)->arrivaltime;
+    }
+    qsort(arrivals, nprocess, sizeof(long long), compare_arrival);
+
+    int arrived = 0;
+    int proc_remaining = 0;
+    for (int e = 0; e < nevents; e++)
+    {
+        while (arrived < nprocess && arrivals[arrived] < events[e].time)
+        {
+            arrived++;
+            proc_remaining++;
+        }
+
+        SchedEvent event;
+        event.time = events[e].time;
+        event.cpu = events[e].cpu;
+        if (events[e].finishing)
+        {
+            // every process finishing at an instant is marked off before any
+            // of them is reported, as the simulator does
+            if (e == 0 || !events[e - 1].finishing || events[e - 1].time != events[e].time)
+            {
+                for (int f = e; f < nevents && events[f].finishing && events[f].time == events[e].time; f++)
+                {
+                    proc_remaining--;
+                }
+            }
+            Process *process = trace_peek(plan->trace, events[e].index);
+            stats_add(stats, process->arrivaltime, process->executiontime, event.time);
+            event.type = SCHED_FINISHED;
+            event.processid = process->processid;
+            event.child = 0;
+            event.parallelisable = process->parallelisable;
+            event.remainingtime = 0;
+            event.cpu = -1;
+            event.arrivaltime = process->arrivaltime;
+            // a plan splits every parallelisable process one per cpu
+            event.nchild = (process->parallelisable == 'p') ? plan->nprocessor : 1;
+        }
+        else
+        {
+            Job *job = &plan->jobs[events[e].index];
+            event.type = SCHED_RUNNING;
+            event.processid = job->data.processid;
+            event.child = job->data.child;
+            event.parallelisable = job->data.parallelisable;
+            event.remainingtime = job->data.remainingtime;
+            event.arrivaltime = 0;
+            event.nchild = 0;
+        }
+        event.proc_remaining = proc_remaining;
+        if (callback != NULL)
+        {
+            callback(&event, context);
+        }
+    }
+
+    free(arrivals);
+    free(events);
+    free(finish);
+    free(finishcpu);
+}
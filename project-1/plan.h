@@ -0,0 +1,103 @@
+/* * * * * * * *  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Description : Module for planning a whole trace ahead of time to finish  *
+ *               it as early as possible, by longest processing time first  *
+ *               placement improved by moving and swapping between cpus     *
+ * Layout by :  Matt Farrugia <matt.farrugia@unimelb.edu.au>                *
+ * Created by :Syed Ahammad Newaz Saif                                      *
+ * Email : snewaz@student.unimelb.edu.au                                    *
+ * Student ID : 684933                                                      *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * * */
+
+#ifndef PLAN_H
+#define PLAN_H
+
+#include "data.h"
+#include "trace.h"
+#include "stats.h"
+#include "sched.h"
+
+/* Steps of work the local search may spend, each step one job looked at. */
+#define PLAN_SEARCH_BUDGET (1LL << 25)
+
+/* * * * * * * * * * *
+ * TYPE DEFINITIONS  *
+ * * * * * * * * * * */
+
+typedef struct job Job;
+typedef struct cpuplan CpuPlan;
+typedef struct plan Plan;
+
+/* * * * * * * * * *
+ * DATA STRUCTURES *
+ * * * * * * * * * */
+
+/* A process, or one of the subprocesses of a parallelisable process, to
+   run start to finish on one cpu. */
+struct job
+{
+    Data data;              // remainingtime is its length, process its place in the trace
+    long long arrivaltime;
+    int pinned;             // 1 for a subprocess, which keeps the cpu of its number
+    int cpu;                // the cpu it is planned on
+};
+
+/* The jobs of a cpu in the order they run: by arrival time, then shortest
+   first, then by processid. A cpu runs whatever it holds whenever it can,
+   so it finishes its jobs at the same time in any such order. */
+struct cpuplan
+{
+    int *jobs;
+    int size;
+    int capacity;
+    long long *finish;  // when job i finishes, the cpu starting at time 0
+    long long *rest;    // total length of job i onwards
+    long long *tail;    // earliest time job i onwards can all finish, however early they start
+};
+
+/* Which cpu runs each job of a trace. */
+struct plan
+{
+    int nprocessor;
+    Trace *trace;
+    Job *jobs;
+    int njobs;
+    CpuPlan *cpus;
+};
+
+/* * * * * * * * * * * * *
+ * FUNCTION DEFINITIONS  *
+ * * * * * * * * * * * * */
+
+/* Creates a plan for every process of trace on nprocessor cpus.
+   Parallelisable processes are split as the simulator splits them, the
+   k-th subprocess on cpu k, and the rest placed longest processing time
+   first: whenever a cpu comes free it takes the longest job arrived by
+   then. O(n log n).
+   Returns a pointer to it. */
+Plan *new_plan(Trace *trace, int nprocessor);
+
+/* Destroys a plan and its associated memory, but not its trace. */
+void free_plan(Plan *plan);
+
+/* Replans every job onto cpus[job], which must keep each subprocess on
+   its own cpu. The jobs may be reordered. */
+void plan_assign(Plan *plan, const int *cpus);
+
+/* Returns whether job a runs before job b on a cpu: by arrival time, then
+   shortest first, then by processid. */
+int job_runs_before(const Job *a, const Job *b);
+
+/* Improves the plan by moving a job off the cpu finishing last, or swapping
+   it with a job of another cpu, while that finishes both cpus
+   earlier than it did, for at most budget steps of work.
+   Returns the number of moves and swaps made. */
+long long plan_improve(Plan *plan, long long budget);
+
+/* Returns the time the last cpu finishes its jobs. */
+long long plan_makespan(Plan *plan);
+
+/* Runs the plan, reporting each event to callback (unless NULL) as the
+   simulator does, and fills in the statistics of the processes in stats. */
+void plan_run(Plan *plan, SchedCallback callback, void *context, Stats *stats);
+
+#endif
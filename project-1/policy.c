@@ -0,0 +1,184 @@
+/* * * * * * * *  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Description : Module for the scheduling policies a simulator can run,    *
+ *               each a table of the decisions that make it up              *
+ * Layout by :  Matt Farrugia <matt.farrugia@unimelb.edu.au>                *
+ * Created by :Syed Ahammad Newaz Saif                                      *
+ * Email : snewaz@student.unimelb.edu.au                                    *
+ * Student ID : 684933                                                      *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * * */
+
+/* List of libraries for the assignment */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <limits.h>
+#include <assert.h>
+#include "policy.h"
+
+/* Helper function that places on the cpu with the least remaining time
+   outstanding, lowest cpu id on a tie. */
+int least_loaded(LoadTree *load, const Data *arriving);
+
+/* Helper function that orders by when processes joined the readyqueue. */
+int first_come_first(const Data *a, const Data *b);
+
+/* Helper function that orders by level, then by when processes joined. */
+int highest_level_first(const Data *a, const Data *b);
+
+/* Helper function for preemption whenever the arriving process runs first. */
+int preempts_if_before(const Policy *policy, const Data *arriving, const Data *running);
+
+/* Helper function for policies that never preempt. */
+int never_preempts(const Policy *policy, const Data *arriving, const Data *running);
+
+/* Helper function for preemption by a process on a higher level. */
+int preempts_if_higher(const Policy *policy, const Data *arriving, const Data *running);
+
+/* Helper function for policies without a timeslice. */
+long long no_timeslice(const Policy *policy, const Data *running);
+
+/* Helper function for a fixed timeslice of the quantum. */
+long long fixed_timeslice(const Policy *policy, const Data *running);
+
+/* Helper function for a timeslice of the quantum doubled for each level. */
+long long level_timeslice(const Policy *policy, const Data *running);
+
+/* Helper function that starts a fresh quantum on the same level. */
+void requeue(const Policy *policy, Data *running);
+
+/* Helper function that starts a fresh quantum one level down. */
+void demote(const Policy *policy, Data *running);
+
+/* * * * * * * * * * * * *
+ * FUNCTION DEFINITIONS  *
+ * * * * * * * * * * * * */
+
+/* Helper function that places on the cpu with the least remaining time
+   outstanding, lowest cpu id on a tie. */
+int least_loaded(LoadTree *load, const Data *arriving)
+{
+    // the running totals are kept ordered, the root is the answer
+    return loadtree_min(load);
+}
+
+/* Helper function that orders by when processes joined the readyqueue. */
+int first_come_first(const Data *a, const Data *b)
+{
+    if (a->sequence != b->sequence)
+    {
+        return a->sequence < b->sequence;
+    }
+    return processid_before(a, b);
+}
+
+/* Helper function that orders by level, then by when processes joined. */
+int highest_level_first(const Data *a, const Data *b)
+{
+    if (a->level != b->level)
+    {
+        return a->level < b->level;
+    }
+    return first_come_first(a, b);
+}
+
+/* Helper function for preemption whenever the arriving process runs first. */
+int preempts_if_before(const Policy *policy, const Data *arriving, const Data *running)
+{
+    return policy->before(arriving, running);
+}
+
+/* Helper function for policies that never preempt. */
+int never_preempts(const Policy *policy, const Data *arriving, const Data *running)
+{
+    return 0;
+}
+
+/* Helper function for preemption by a process on a higher level. */
+int preempts_if_higher(const Policy *policy, const Data *arriving, const Data *running)
+{
+    return arriving->level < running->level;
+}
+
+/* Helper function for policies without a timeslice. */
+long long no_timeslice(const Policy *policy, const Data *running)
+{
+    return LLONG_MAX;
+}
+
+/* Helper function for a fixed timeslice of the quantum. */
+long long fixed_timeslice(const Policy *policy, const Data *running)
+{
+    return policy->quantum;
+}
+
+/* Helper function for a timeslice of the quantum doubled for each level. */
+long long level_timeslice(const Policy *policy, const Data *running)
+{
+    return policy->quantum << running->level;
+}
+
+/* Helper function that starts a fresh quantum on the same level. */
+void requeue(const Policy *policy, Data *running)
+{
+    running->used = 0;
+}
+
+/* Helper function that starts a fresh quantum one level down. */
+void demote(const Policy *policy, Data *running)
+{
+    if (running->level < MLFQ_LEVELS - 1)
+    {
+        running->level++;
+    }
+    running->used = 0;
+}
+
+/* Returns shortest remaining time first, the default policy. */
+Policy srtf_policy()
+{
+    Policy policy = {"srtf", 0, least_loaded, shortest_first, preempts_if_before, no_timeslice, requeue};
+    return policy;
+}
+
+/* Finds the policy named by spec: 'srtf', 'fcfs', 'rr' or 'mlfq', the
+   last two optionally followed by ':quantum'.
+   Returns 1 with the policy filled in, 0 if there is no such policy. */
+int find_policy(const char *spec, Policy *policy)
+{
+    assert(spec != NULL && policy != NULL);
+    const Policy policies[] =
+    {
+        {"srtf", 0, least_loaded, shortest_first, preempts_if_before, no_timeslice, requeue},
+        {"fcfs", 0, least_loaded, first_come_first, never_preempts, no_timeslice, requeue},
+        {"rr", DEFAULT_QUANTUM, least_loaded, first_come_first, never_preempts, fixed_timeslice, requeue},
+        {"mlfq", DEFAULT_QUANTUM, least_loaded, highest_level_first, preempts_if_higher, level_timeslice, demote},
+    };
+    int npolicies = sizeof(policies) / sizeof(policies[0]);
+
+    // the name runs up to the quantum, if there is one
+    const char *colon = strchr(spec, ':');
+    size_t length = colon ? (size_t)(colon - spec) : strlen(spec);
+    for (int i = 0; i < npolicies; i++)
+    {
+        if (strlen(policies[i].name) != length || strncmp(spec, policies[i].name, length) != 0)
+        {
+            continue;
+        }
+        *policy = policies[i];
+        if (colon == NULL)
+        {
+            return 1;
+        }
+
+        // only policies with a quantum take one
+        long long quantum;
+        char extra;
+        if (policy->quantum == 0 || sscanf(colon + 1, "%lld%c", &quantum, &extra) != 1 || quantum < 1)
+        {
+            return 0;
+        }
+        policy->quantum = quantum;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,70 @@
+/* * * * * * * *  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Description : Module for the scheduling policies a simulator can run,    *
+ *               each a table of the decisions that make it up              *
+ * Layout by :  Matt Farrugia <matt.farrugia@unimelb.edu.au>                *
+ * Created by :Syed Ahammad Newaz Saif                                      *
+ * Email : snewaz@student.unimelb.edu.au                                    *
+ * Student ID : 684933                                                      *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * * */
+
+#ifndef POLICY_H
+#define POLICY_H
+
+#include "data.h"
+#include "heap.h"
+#include "loadtree.h"
+
+/* Quantum of round robin and of the top level of the multilevel feedback
+   queue unless one is given. */
+#define DEFAULT_QUANTUM 10
+
+/* Levels of the multilevel feedback queue, the quantum doubling each level. */
+#define MLFQ_LEVELS 4
+
+/* * * * * * * * * * *
+ * TYPE DEFINITIONS  *
+ * * * * * * * * * * */
+
+typedef struct policy Policy;
+
+/* * * * * * * * * *
+ * DATA STRUCTURES *
+ * * * * * * * * * */
+
+/* The decisions a scheduling policy makes. Each cpu runs one process at a
+   time out of its own readyqueue. */
+struct policy
+{
+    const char *name;
+    long long quantum;  // 0 if processes run until they finish or are preempted
+
+    // Returns the cpu an arriving process (or subprocess) goes to.
+    int (*place)(LoadTree *load, const Data *arriving);
+
+    // Returns whether a runs before b in a readyqueue, ties broken too.
+    HeapOrder before;
+
+    // Returns whether an arriving process takes the cpu from the running one.
+    int (*preempts)(const Policy *policy, const Data *arriving, const Data *running);
+
+    // Returns the time a running process may run before it goes back to its
+    // readyqueue, LLONG_MAX if there is no limit.
+    long long (*timeslice)(const Policy *policy, const Data *running);
+
+    // Updates a process that has used up its timeslice.
+    void (*expire)(const Policy *policy, Data *running);
+};
+
+/* * * * * * * * * * * * *
+ * FUNCTION DEFINITIONS  *
+ * * * * * * * * * * * * */
+
+/* Returns shortest remaining time first, the default policy. */
+Policy srtf_policy();
+
+/* Finds the policy named by spec: 'srtf', 'fcfs', 'rr' or 'mlfq', the
+   last two optionally followed by ':quantum'.
+   Returns 1 with the policy filled in, 0 if there is no such policy. */
+int find_policy(const char *spec, Policy *policy);
+
+#endif
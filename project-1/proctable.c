@@ -0,0 +1,101 @@
+/* * * * * * * *  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Description : Module for the table of in-flight processes, the ones that *
+ *               have arrived but not yet finished, with reusable slots     *
+ * Layout by :  Matt Farrugia <matt.farrugia@unimelb.edu.au>                *
+ * Created by :Syed Ahammad Newaz Saif                                      *
+ * Email : snewaz@student.unimelb.edu.au                                    *
+ * Student ID : 684933                                                      *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * * */
+
+/* List of libraries for the assignment */
+#include <stdlib.h>
+#include <assert.h>
+#include "proctable.h"
+
+/* Initial number of slots a table has room for before it grows. */
+#define INITIAL_CAPACITY 16
+
+/* * * * * * * * * * * * *
+ * FUNCTION DEFINITIONS  *
+ * * * * * * * * * * * * */
+
+/* Creates a new, empty table and returns a pointer to it. */
+ProcTable *new_proctable()
+{
+    ProcTable *table = malloc(sizeof *table);
+    assert(table);
+
+    table->slots = malloc(sizeof(Slot) * INITIAL_CAPACITY);
+    assert(table->slots);
+    table->capacity = INITIAL_CAPACITY;
+    table->size = 0;
+
+    // thread every slot onto the free list
+    for (int i = 0; i < INITIAL_CAPACITY; i++)
+    {
+        table->slots[i].nextfree = (i + 1 < INITIAL_CAPACITY) ? i + 1 : -1;
+    }
+    table->freelist = 0;
+
+    return table;
+}
+
+/* Destroys a table and its associated memory. */
+void free_proctable(ProcTable *table)
+{
+    assert(table != NULL);
+    free(table->slots);
+    free(table);
+}
+
+/* Copies an arriving process into a free slot. Amortised O(1).
+   Returns the handle of the slot. */
+int proctable_add(ProcTable *table, Process *process)
+{
+    assert(table != NULL);
+
+    // no free slot left, double the room and free the new half
+    if (table->freelist == -1)
+    {
+        int old = table->capacity;
+        table->capacity *= 2;
+        table->slots = realloc(table->slots, sizeof(Slot) * table->capacity);
+        assert(table->slots);
+        for (int i = old; i < table->capacity; i++)
+        {
+            table->slots[i].nextfree = (i + 1 < table->capacity) ? i + 1 : -1;
+        }
+        table->freelist = old;
+    }
+
+    int handle = table->freelist;
+    Slot *slot = &table->slots[handle];
+    table->freelist = slot->nextfree;
+
+    slot->process = *process;
+    slot->number_child = 0;
+    slot->nchild = 0;
+    slot->gang = NULL;
+    table->size++;
+
+    return handle;
+}
+
+/* Returns the slot behind a handle. O(1). */
+Slot *proctable_get(ProcTable *table, int handle)
+{
+    assert(table != NULL);
+    assert(handle >= 0 && handle < table->capacity);
+    return &table->slots[handle];
+}
+
+/* Frees the slot of a finished process for reuse. O(1). */
+void proctable_remove(ProcTable *table, int handle)
+{
+    assert(table != NULL);
+    assert(handle >= 0 && handle < table->capacity);
+
+    table->slots[handle].nextfree = table->freelist;
+    table->freelist = handle;
+    table->size--;
+}
@@ -0,0 +1,68 @@
+/* * * * * * * *  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Description : Module for the table of in-flight processes, the ones that *
+ *               have arrived but not yet finished, with reusable slots     *
+ * Layout by :  Matt Farrugia <matt.farrugia@unimelb.edu.au>                *
+ * Created by :Syed Ahammad Newaz Saif                                      *
+ * Email : snewaz@student.unimelb.edu.au                                    *
+ * Student ID : 684933                                                      *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * * */
+
+#ifndef PROCTABLE_H
+#define PROCTABLE_H
+
+#include "trace.h"
+
+/* * * * * * * * * * *
+ * TYPE DEFINITIONS  *
+ * * * * * * * * * * */
+
+typedef struct slot Slot;
+typedef struct proctable ProcTable;
+
+/* * * * * * * * * *
+ * DATA STRUCTURES *
+ * * * * * * * * * */
+
+/* The cold record of an in-flight process and its completion bookkeeping. */
+struct slot
+{
+    Process process;
+    int number_child; // subprocesses finished so far
+    int nchild;       // subprocesses it was split into
+    int *gang;        // cpu of each subprocess when they run together, NULL otherwise
+    int nextfree;     // next free slot, while this one is free
+};
+
+/* Slots freed by finished processes are handed out again first, so the
+   table only ever grows to the peak number of processes in flight.
+   Processes are found by the handle of their slot, never by processid, so
+   a large or sparse processid costs no more than a small one. */
+struct proctable
+{
+    Slot *slots;
+    int capacity;
+    int size;     // processes in flight
+    int freelist; // first free slot, -1 if none
+};
+
+/* * * * * * * * * * * * *
+ * FUNCTION DEFINITIONS  *
+ * * * * * * * * * * * * */
+
+/* Creates a new, empty table and returns a pointer to it. */
+ProcTable *new_proctable();
+
+/* Destroys a table and its associated memory. */
+void free_proctable(ProcTable *table);
+
+/* Copies an arriving process into a free slot. Amortised O(1).
+   Returns the handle of the slot. */
+int proctable_add(ProcTable *table, Process *process);
+
+/* Returns the slot behind a handle. O(1). */
+Slot *proctable_get(ProcTable *table, int handle);
+
+/* Frees the slot of a finished process for reuse. O(1). */
+void proctable_remove(ProcTable *table, int handle);
+
+#endif
@@ -0,0 +1,879 @@
+/* * * * * * * *  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Description : Library for scheduling processes on a number of           *
+ *               processors under a pluggable policy, fed one process at a  *
+ *               time and advanced to any point in simulated time           *
+ * Resources :  https://www.youtube.com/watch?v=_QcX99B-zbU&t=707s          *
+ * Created by :Syed Ahammad Newaz Saif                                      *
+ * Email : snewaz@student.unimelb.edu.au                                    *
+ * Student ID : 684933                                                      *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * * */
+
+/* List of libraries for the assignment */
+#include <stdlib.h>
+#include <assert.h>
+#include <limits.h>
+
+/* Accompanying libraries the simulator is built from */
+#include "data.h"
+#include "heap.h"
+#include "loadtree.h"
+#include "proctable.h"
+#include "segmentlog.h"
+#include "policy.h"
+#include "sched.h"
+
+/* Initial number of submitted processes there is room for. */
+#define INITIAL_PENDING 16
+
+/* Load added to a cpu taken for a gang, to keep it from being taken again. */
+#define GANG_TAKEN (1LL << 62)
+
+/* Everything a simulation changes, so any number of them can run at once. */
+struct simulator
+{
+    int nprocessor;
+    long long time;             // time of the latest event
+    int proc_remaining;         // processes arrived and yet to finish
+    Heap **readyqueue;          // processes waiting on each cpu
+    Data *running;              // the process running on each cpu
+    int *busy;                  // 1 if a cpu has a process running
+    Data *lastrun;              // the latest process run on each cpu, its processid -1 if none
+    LoadTree *load;
+    ProcTable *table;           // processes in flight
+    Stats stats;
+    int stealing;               // 1 if idle cpus take waiting work
+    int gang;                   // 1 if the subprocesses of a process run together
+    Policy policy;
+    Split split;                // how many subprocesses a parallelisable process makes
+    long long sequence;         // count of processes joining readyqueues
+    SchedCallback callback;
+    void *context;
+    SegmentLog *segments;       // what ran where and when, NULL unless logged
+
+    // processes submitted and yet to arrive, a ring in order of submission
+    Process *pending;
+    int pendinghead;
+    int pendingcount;
+    int pendingcapacity;
+};
+
+/* Helper function that queues up a submitted process. Amortised O(1). */
+void pending_push(Simulator *sim, Process process);
+
+/* Helper function that returns the oldest submitted process yet to
+   arrive, NULL if there are none. */
+Process *pending_peek(Simulator *sim);
+
+/* Helper function that takes the oldest submitted process off. */
+void pending_pop(Simulator *sim);
+
+/* Helper function that runs the event at time. */
+void sched_step(Simulator *sim, long long time);
+
+/* Helper function that hands each idle cpu waiting work from the others. */
+void steal_work(Simulator *sim);
+
+/* Helper function that puts a process back in its cpu's readyqueue. */
+void requeue_process(Simulator *sim, Data data, int index);
+
+/* Helper function that hands each idle cpu the process that runs first in
+   its readyqueue, a subprocess run together with its siblings only once
+   every one of them can start. */
+void dispatch_idle(Simulator *sim);
+
+/* Helper function that returns whether data is a subprocess run together
+   with its siblings. */
+int in_gang(Simulator *sim, const Data *data);
+
+/* Helper function that places the k subprocesses of a process on k
+   different cpus, the least loaded, to run together. */
+void admit_gang(Simulator *sim, Slot *slot, Data *dataarray, int k);
+
+/* Helper function that puts the running subprocesses of the process of
+   handle back in their readyqueues, keeping their places. */
+void yield_gang(Simulator *sim, int handle);
+
+/* Helper function that starts a fresh timeslice for the subprocesses of
+   the process of handle, which all run out at once, and puts them all back
+   in their readyqueues if any of them has work waiting behind it. */
+void expire_gang(Simulator *sim, int handle);
+
+/* * * * * * * * * * * * *
+ * FUNCTION DEFINITIONS  *
+ * * * * * * * * * * * * */
+
+/* Creates a simulator of nprocessor processors at time 0 with nothing
+   submitted. callback, if not NULL, is called with every event.
+   Returns a pointer to it. */
+Simulator *sched_new(int nprocessor, SchedCallback callback, void *context)
+{
+    assert(nprocessor >= 1);
+    Simulator *sim = malloc(sizeof *sim);
+    assert(sim);
+
+    sim->nprocessor = nprocessor;
+    sim->time = 0;
+    sim->proc_remaining = 0;
+    sim->readyqueue = malloc(sizeof(Heap*) * nprocessor);
+    sim->running = malloc(sizeof(Data) * nprocessor);
+    sim->busy = malloc(sizeof(int) * nprocessor);
+    sim->lastrun = malloc(sizeof(Data) * nprocessor);
+    assert(sim->readyqueue && sim->running && sim->busy && sim->lastrun);
+    sim->load = new_loadtree(nprocessor);
+    sim->table = new_proctable();
+    sim->stealing = 0;
+    sim->gang = 0;
+    sim->policy = srtf_policy();
+    sim->split = all_split();
+    sim->sequence = 0;
+    sim->callback = callback;
+    sim->context = context;
+    sim->segments = NULL;
+
+    // no process has finished yet
+    stats_init(&sim->stats);
+
+    // generate processors as requested
+    for (int i = 0; i < nprocessor; i++)
+    {
+        sim->lastrun[i].processid = -1;
+        sim->readyqueue[i] = new_heap_ordered(sim->policy.before);
+        sim->busy[i] = 0;
+    }
+
+    sim->pending = malloc(sizeof(Process) * INITIAL_PENDING);
+    assert(sim->pending);
+    sim->pendinghead = 0;
+    sim->pendingcount = 0;
+    sim->pendingcapacity = INITIAL_PENDING;
+
+    return sim;
+}
+
+/* Destroys a simulator and everything it holds. */
+void sched_free(Simulator *sim)
+{
+    assert(sim != NULL);
+    for (int i = 0; i < sim->nprocessor; i++)
+    {
+        free_heap(sim->readyqueue[i]);
+    }
+    free(sim->readyqueue);
+    free(sim->running);
+    free(sim->busy);
+    free(sim->lastrun);
+    free_loadtree(sim->load);
+    free_proctable(sim->table);
+    free(sim->pending);
+    free(sim);
+}
+
+/* Helper function that queues up a submitted process. Amortised O(1). */
+void pending_push(Simulator *sim, Process process)
+{
+    // double the ring when full, unwrapping it into the new room
+    if (sim->pendingcount == sim->pendingcapacity)
+    {
+        Process *pending = malloc(sizeof(Process) * sim->pendingcapacity * 2);
+        assert(pending);
+        for (int i = 0; i < sim->pendingcount; i++)
+        {
+            pending[i] = sim->pending[(sim->pendinghead + i) % sim->pendingcapacity];
+        }
+        free(sim->pending);
+        sim->pending = pending;
+        sim->pendinghead = 0;
+        sim->pendingcapacity *= 2;
+    }
+    sim->pending[(sim->pendinghead + sim->pendingcount) % sim->pendingcapacity] = process;
+    sim->pendingcount++;
+}
+
+/* Helper function that returns the oldest submitted process yet to
+   arrive, NULL if there are none. */
+Process *pending_peek(Simulator *sim)
+{
+    return (sim->pendingcount > 0) ? &sim->pending[sim->pendinghead] : NULL;
+}
+
+/* Helper function that takes the oldest submitted process off. */
+void pending_pop(Simulator *sim)
+{
+    assert(sim->pendingcount > 0);
+    sim->pendinghead = (sim->pendinghead + 1) % sim->pendingcapacity;
+    sim->pendingcount--;
+}
+
+/* Reports a process or subprocess starting to run on cpu index. */
+void emit_running(Simulator *sim, Data data, int index)
+{
+    if (sim->callback == NULL)
+    {
+        return;
+    }
+    SchedEvent event;
+    event.type = SCHED_RUNNING;
+    event.time = sim->time;
+    event.processid = data.processid;
+    event.child = data.child;
+    event.parallelisable = data.parallelisable;
+    event.remainingtime = data.remainingtime;
+    event.cpu = index;
+    event.proc_remaining = sim->proc_remaining;
+    event.arrivaltime = 0;
+    event.nchild = 0;
+    sim->callback(&event, sim->context);
+}
+
+/* Reports a whole process finishing, with how many subprocesses it ran as. */
+void emit_finished(Simulator *sim, Slot *slot)
+{
+    if (sim->callback == NULL)
+    {
+        return;
+    }
+    Process *process = &slot->process;
+    SchedEvent event;
+    event.type = SCHED_FINISHED;
+    event.time = sim->time;
+    event.processid = process->processid;
+    event.child = 0;
+    event.parallelisable = process->parallelisable;
+    event.remainingtime = 0;
+    event.cpu = -1;
+    event.proc_remaining = sim->proc_remaining;
+    event.arrivaltime = process->arrivaltime;
+    event.nchild = (slot->nchild > 0) ? slot->nchild : 1;
+    sim->callback(&event, sim->context);
+}
+
+/* Takes the parent process's data, its execution time and number of
+   processes = k to update the subprocesses' fields.
+   Returns the parent process with child encapsulated. */
+Data *create_subprocess(Data *dataarray, Data newdata, long long executiontime, int k)
+{
+    for (int i = 0; i < k; i++)
+    {
+        // copy parent's data to child, the handle still leads to the parent
+        dataarray[i] = newdata;
+        // the parent's pid, told apart by which subprocess it is
+        dataarray[i].child = i;
+        //updated execution time
+        dataarray[i].remainingtime = subprocess_time(executiontime, k);
+    }
+    return dataarray;
+}
+
+/* The program schedules the process to the cpu.
+   Reports it running.
+   Only the latest process run on each cpu is looked at, so only it is
+   kept. */
+void schedule_cpu(Simulator *sim, Data newdata, int index)
+{
+    sim->lastrun[index] = newdata;
+    // report the running process
+    emit_running(sim, newdata, index);
+}
+
+/* Marks off a finished process or subprocess on the slot of its process.
+   Returns 1 if the whole process has now finished (a non parallel process, or
+   the last of the subprocesses of a parallelisable process), 0 otherwise. */
+int mark_process_done(Slot *slot, Data finisheddata)
+{
+    if (finisheddata.parallelisable == 'n')
+    {
+        return 1;
+    }
+    else if (finisheddata.parallelisable == 'p')
+    {
+        // mark off and add up to a previous subprocess finished
+        slot->number_child += 1;
+        //if all children popped off
+        return slot->number_child == slot->nchild;
+    }
+    return 0;
+}
+
+/* Folds the stats of a finished process (the parent for subprocesses) into
+   the running statistics.
+   Reports the finished process. */
+void finished_process(Simulator *sim, Slot *slot)
+{
+    // store and record of the stats of the process
+    Process *process = &slot->process;
+    stats_add(&sim->stats, process->arrivaltime, process->executiontime, sim->time);
+
+    // report the finished process
+    emit_finished(sim, slot);
+}
+
+/* Advances every running process by the time elapsed since the previous
+   event, then retires the ones that finish, sends the ones out of time back
+   to their readyqueue and inserts into cpu whichever process takes over. */
+void update_readyqueue_cpu(Simulator *sim, long long elapsed)
+{
+    Heap **readyqueue = sim->readyqueue;
+    int nprocessor = sim->nprocessor;
+    int process_pop = 0;
+
+    // loop and update the remaining time of the running processes
+    for (int t = 0; t < nprocessor; t++)
+    {
+        if (sim->busy[t])
+        {
+            sim->running[t].remainingtime -= elapsed;
+            sim->running[t].used += elapsed;
+            loadtree_add(sim->load, t, -elapsed);
+        }
+    }
+
+    // check for when the processes finish and collect them, handy for collecting all
+    // simultaneous finishes
+    Data* processes_completed = NULL;
+    int insertion = 0;
+    for (int t = 0; t < nprocessor; t++)
+    {
+        if (sim->busy[t] && sim->running[t].remainingtime == 0)
+        {
+            sim->busy[t] = 0;
+            // allocate fresh memories to collect completed processes
+            processes_completed = realloc(processes_completed, sizeof(Data)*(insertion+1));
+            processes_completed[insertion] = sim->running[t];
+            // know how much finished for later looping
+            insertion++;
+            // flag to indicate processes finished
+            process_pop = 1;
+        }
+    }
+
+    // check if there are processes finished, then collect stats and report
+    if(process_pop==1)
+    {
+        // mark of processes done first, so every simultaneous finish is
+        // already taken off the count of processes remaining
+        int finished = 0;
+        for(int u= 0; u < insertion;u++)
+        {
+            if (mark_process_done(proctable_get(sim->table, processes_completed[u].process), processes_completed[u]))
+            {
+                processes_completed[finished] = processes_completed[u];
+                finished++;
+                sim->proc_remaining--;
+            }
+        }
+        // calculate and store the stats of the processes done
+        for(int u= 0; u < finished;u++)
+        {
+            // delegation to finished process, its slot is no longer needed
+            finished_process(sim, proctable_get(sim->table, processes_completed[u].process));
+            free(proctable_get(sim->table, processes_completed[u].process)->gang);
+            proctable_remove(sim->table, processes_completed[u].process);
+        }
+        // must free up the space used to track processes done
+        free(processes_completed);
+    }
+
+    // processes out of time give way to whatever is waiting behind them
+    for (int t = 0; t < nprocessor; t++)
+    {
+        if (sim->busy[t] && sim->running[t].used >= sim->policy.timeslice(&sim->policy, &sim->running[t]))
+        {
+            // siblings run out together and are dealt with together
+            if (in_gang(sim, &sim->running[t]))
+            {
+                if (sim->running[t].child == 0)
+                {
+                    expire_gang(sim, sim->running[t].process);
+                }
+                continue;
+            }
+            sim->policy.expire(&sim->policy, &sim->running[t]);
+            if (heap_size(readyqueue[t]) > 0)
+            {
+                sim->busy[t] = 0;
+                requeue_process(sim, sim->running[t], t);
+            }
+        }
+    }
+
+    // cpus left idle take over waiting work before anything is dispatched
+    if (sim->stealing)
+    {
+        steal_work(sim);
+    }
+
+    // schedule tasks for the cpus left idle
+    dispatch_idle(sim);
+}
+
+/* Helper function that hands each idle cpu the process that runs first in
+   its readyqueue, a subprocess run together with its siblings only once
+   every one of them can start. */
+void dispatch_idle(Simulator *sim)
+{
+    Heap **readyqueue = sim->readyqueue;
+    for (int t = 0; t < sim->nprocessor; t++)
+    {
+        if (sim->busy[t] || heap_size(readyqueue[t]) == 0)
+        {
+            continue;
+        }
+
+        if (in_gang(sim, heap_peek_min(readyqueue[t])))
+        {
+            // every sibling must be first on a cpu that is free, or taken
+            // over from a lone process it preempts, or the cpu waits
+            int handle = heap_peek_min(readyqueue[t])->process;
+            Slot *slot = proctable_get(sim->table, handle);
+            int ready = 1;
+            for (int i = 0; i < slot->nchild && ready; i++)
+            {
+                int c = slot->gang[i];
+                Data *sibling = (heap_size(readyqueue[c]) > 0) ? heap_peek_min(readyqueue[c]) : NULL;
+                ready = sibling != NULL && sibling->process == handle && (!sim->busy[c] ||
+                    (!in_gang(sim, &sim->running[c]) && sim->policy.preempts(&sim->policy, sibling, &sim->running[c])));
+            }
+            for (int i = 0; i < slot->nchild && ready; i++)
+            {
+                int c = slot->gang[i];
+                Data sibling = heap_remove_min(readyqueue[c]);
+                if (sim->busy[c])
+                {
+                    heap_insert(readyqueue[c], sim->running[c]);
+                }
+                sim->running[c] = sibling;
+                sim->busy[c] = 1;
+                if (!same_processid(&sim->lastrun[c], &sim->running[c]))
+                {
+                    schedule_cpu(sim, sim->running[c], c);
+                }
+            }
+            continue;
+        }
+
+        sim->running[t] = heap_remove_min(readyqueue[t]);
+        sim->busy[t] = 1;
+        // if the process taking over is different to the last one run on the cpu
+        if (!same_processid(&sim->lastrun[t], &sim->running[t]))
+        {
+            schedule_cpu(sim, sim->running[t], t);
+        }
+    }
+}
+
+/* Helper function that returns whether data is a subprocess run together
+   with its siblings. */
+int in_gang(Simulator *sim, const Data *data)
+{
+    return sim->gang && data->parallelisable == 'p';
+}
+
+/* Helper function that places the k subprocesses of a process on k
+   different cpus, the least loaded, to run together. */
+void admit_gang(Simulator *sim, Slot *slot, Data *dataarray, int k)
+{
+    // take the least loaded cpu k times, each put out of reach once taken
+    slot->gang = malloc(sizeof(int) * k);
+    assert(slot->gang);
+    for (int i = 0; i < k; i++)
+    {
+        slot->gang[i] = loadtree_min(sim->load);
+        loadtree_add(sim->load, slot->gang[i], GANG_TAKEN);
+    }
+    for (int i = 0; i < k; i++)
+    {
+        loadtree_add(sim->load, slot->gang[i], dataarray[i].remainingtime - GANG_TAKEN);
+    }
+
+    // the siblings take their cpus only if they can take every one of them
+    int preempts = 1;
+    for (int i = 0; i < k && preempts; i++)
+    {
+        int c = slot->gang[i];
+        preempts = !sim->busy[c] || sim->policy.preempts(&sim->policy, &dataarray[i], &sim->running[c]);
+    }
+    for (int i = 0; i < k; i++)
+    {
+        int c = slot->gang[i];
+        if (preempts && sim->busy[c] && in_gang(sim, &sim->running[c]))
+        {
+            yield_gang(sim, sim->running[c].process);
+        }
+        else if (preempts && sim->busy[c])
+        {
+            heap_insert(sim->readyqueue[c], sim->running[c]);
+            sim->busy[c] = 0;
+        }
+        heap_insert(sim->readyqueue[c], dataarray[i]);
+    }
+    // they start once the arrivals are all in
+}
+
+/* Helper function that puts the running subprocesses of the process of
+   handle back in their readyqueues, keeping their places. */
+void yield_gang(Simulator *sim, int handle)
+{
+    Slot *slot = proctable_get(sim->table, handle);
+    for (int i = 0; i < slot->nchild; i++)
+    {
+        int c = slot->gang[i];
+        if (sim->busy[c] && sim->running[c].process == handle)
+        {
+            heap_insert(sim->readyqueue[c], sim->running[c]);
+            sim->busy[c] = 0;
+        }
+    }
+}
+
+/* Helper function that starts a fresh timeslice for the subprocesses of
+   the process of handle, which all run out at once, and puts them all back
+   in their readyqueues if any of them has work waiting behind it. */
+void expire_gang(Simulator *sim, int handle)
+{
+    Slot *slot = proctable_get(sim->table, handle);
+    int waiting = 0;
+    for (int i = 0; i < slot->nchild; i++)
+    {
+        int c = slot->gang[i];
+        sim->policy.expire(&sim->policy, &sim->running[c]);
+        waiting = waiting || heap_size(sim->readyqueue[c]) > 0;
+    }
+    for (int i = 0; i < slot->nchild && waiting; i++)
+    {
+        int c = slot->gang[i];
+        sim->busy[c] = 0;
+        requeue_process(sim, sim->running[c], c);
+    }
+}
+
+/* Helper function that hands each idle cpu waiting work from the others.
+   An idle cpu with nothing waiting, lowest id first, takes the waiting
+   process that runs first from the readyqueue with the most remaining time
+   in total (lowest id on a tie). Only processes waiting are taken, so
+   nothing running is ever moved. */
+void steal_work(Simulator *sim)
+{
+    for (int thief = 0; thief < sim->nprocessor; thief++)
+    {
+        if (sim->busy[thief] || heap_size(sim->readyqueue[thief]) > 0)
+        {
+            continue;
+        }
+
+        // find the most loaded readyqueue with work waiting, an idle cpu
+        // keeping the first of its own
+        int victim = -1;
+        for (int t = 0; t < sim->nprocessor; t++)
+        {
+            int waiting = heap_size(sim->readyqueue[t]) - (sim->busy[t] ? 0 : 1);
+            // subprocesses run together keep the cpus they were given
+            if (waiting > 0 && in_gang(sim, heap_peek_min(sim->readyqueue[t])))
+            {
+                continue;
+            }
+            if (waiting > 0 && (victim == -1 || loadtree_load(sim->load, t) > loadtree_load(sim->load, victim)))
+            {
+                victim = t;
+            }
+        }
+        if (victim == -1)
+        {
+            // nothing is waiting anywhere
+            return;
+        }
+
+        // move the process over along with its share of the load
+        Data stolen = heap_remove_min(sim->readyqueue[victim]);
+        loadtree_add(sim->load, victim, -stolen.remainingtime);
+        heap_insert(sim->readyqueue[thief], stolen);
+        loadtree_add(sim->load, thief, stolen.remainingtime);
+    }
+}
+
+/* Helper function that puts a process back in its cpu's readyqueue. */
+void requeue_process(Simulator *sim, Data data, int index)
+{
+    // it joins the back of the queue for policies going by arrival
+    data.sequence = sim->sequence++;
+    heap_insert(sim->readyqueue[index], data);
+}
+
+/* Fills in a readyqueue and then assigns a process to the cpu if it is
+   idle or if the policy lets the process take the cpu from the one running
+   there. */
+void store_assign_task(Simulator *sim, Data newdata)
+{
+    // the policy picks the cpu, by default the least remaining time
+    // (readqueue id correspondence to cpu id preferred over similar
+    // remaining time)
+    int index = sim->policy.place(sim->load, &newdata);
+    loadtree_add(sim->load, index, newdata.remainingtime);
+
+    // if the cpu is idle, the process runs straight away
+    if (!sim->busy[index])
+    {
+        sim->running[index] = newdata;
+        sim->busy[index] = 1;
+        schedule_cpu(sim, newdata, index);
+    }
+    else if (sim->policy.preempts(&sim->policy, &newdata, &sim->running[index]))
+    {
+        // the process running goes back to wait, keeping its place, along
+        // with its siblings if they run together
+        Data prevdata = sim->running[index];
+        if (in_gang(sim, &prevdata))
+        {
+            yield_gang(sim, prevdata.process);
+        }
+        else
+        {
+            heap_insert(sim->readyqueue[index], prevdata);
+        }
+        sim->running[index] = newdata;
+        sim->busy[index] = 1;
+
+        // a process with different pid is allowed for a switch on the cpu
+        if (!same_processid(&prevdata, &newdata))
+        {
+            schedule_cpu(sim, newdata, index);
+        }
+    }
+    else
+    {
+        heap_insert(sim->readyqueue[index], newdata);
+    }
+}
+
+/* This program handles every submitted process due by the time reached, in the
+   order submitted. Each arriving process is copied into a slot of the table of
+   processes in flight.
+   Simultaneous arrivals are first ordered as the policy orders a readyqueue (by
+   default remaining time, then processid) and each one, or each of its subprocesses
+   when parallelisable, goes to the cpu the policy places it on. */
+void admit_arrivals(Simulator *sim)
+{
+    // collect every process arriving at this instant, the heap hands the
+    // ones that run first out first so they claim the idle cpus
+    Heap *arrivals = new_heap_ordered(sim->policy.before);
+    Process *process;
+    while ((process = pending_peek(sim)) != NULL && process->arrivaltime <= sim->time)
+    {
+        Data newdata;
+        newdata.remainingtime = process->executiontime;
+        newdata.sequence = sim->sequence++;
+        newdata.used = 0;
+        newdata.level = 0;
+        newdata.process = proctable_add(sim->table, process);
+        newdata.processid = process->processid;
+        newdata.child = 0;
+        newdata.parallelisable = process->parallelisable;
+        heap_insert(arrivals, newdata);
+        pending_pop(sim);
+    }
+
+    while (heap_size(arrivals) > 0)
+    {
+        Data newdata = heap_remove_min(arrivals);
+        // delegate task and store and assign each process from readyqueue to cpu
+        if (newdata.parallelisable == 'n')
+        {
+            store_assign_task(sim, newdata);
+            sim->proc_remaining++;
+        }
+        else if (newdata.parallelisable == 'p')
+        {
+            // store, delegate and assign cpu by creating, copying subprocesses onto an array
+            // free memory once completed, as many as the split chooses
+            Slot *slot = proctable_get(sim->table, newdata.process);
+            slot->nchild = sim->split.factor(&sim->split, slot->process.executiontime, sim->nprocessor, sim->load);
+            assert(slot->nchild >= 1 && slot->nchild <= sim->nprocessor);
+            Data *dataarray = malloc(sizeof(Data) * slot->nchild);
+            dataarray = create_subprocess(dataarray, newdata, slot->process.executiontime, slot->nchild);
+
+            if (sim->gang)
+            {
+                admit_gang(sim, slot, dataarray, slot->nchild);
+            }
+            for (int i = 0; i < slot->nchild && !sim->gang; i++)
+            {
+                store_assign_task(sim, dataarray[i]);
+            }
+            free(dataarray);
+            // the subprocesses count as one process until the last one finishes
+            sim->proc_remaining++;
+        }
+    }
+    free_heap(arrivals);
+}
+
+/* Finds the next instant at which something happens in the simulation: the
+   next submitted process arrives, a running process finishes or a running
+   process runs out of time. Nothing changes in between, so the clock jumps there.
+   Returns 1 with the time of the next event in next, 0 if nothing is left. */
+int next_event_time(Simulator *sim, long long *next)
+{
+    int found = 0;
+    *next = LLONG_MAX;
+
+    // the next arrival
+    Process *process = pending_peek(sim);
+    if (process != NULL)
+    {
+        *next = process->arrivaltime;
+        found = 1;
+    }
+
+    // the earliest completion or timeslice running out among the running processes
+    for (int i = 0; i < sim->nprocessor; i++)
+    {
+        if (!sim->busy[i])
+        {
+            continue;
+        }
+        long long until = sim->running[i].remainingtime;
+        long long timeslice = sim->policy.timeslice(&sim->policy, &sim->running[i]);
+        if (timeslice != LLONG_MAX && timeslice - sim->running[i].used < until)
+        {
+            until = timeslice - sim->running[i].used;
+        }
+        if (sim->time + until < *next)
+        {
+            *next = sim->time + until;
+            found = 1;
+        }
+    }
+
+    // arrivals submitted out of order are admitted straight away
+    if (*next < sim->time)
+    {
+        *next = sim->time;
+    }
+    return found;
+}
+
+/* Helper function that runs the event at time. */
+void sched_step(Simulator *sim, long long time)
+{
+    long long elapsed = time - sim->time;
+    sim->time = time;
+
+    // update on the running processes, finishing processes leave first
+    update_readyqueue_cpu(sim, elapsed);
+
+    // assign upon arrival
+    Process *process = pending_peek(sim);
+    if (process != NULL && process->arrivaltime <= time)
+    {
+        admit_arrivals(sim);
+    }
+
+    // siblings run together start once everything arriving is in place
+    if (sim->gang)
+    {
+        dispatch_idle(sim);
+    }
+
+    // close and open the segments of cpus that switched
+    if (sim->segments != NULL)
+    {
+        for (int t = 0; t < sim->nprocessor; t++)
+        {
+            segmentlog_update(sim->segments, t, sim->busy[t] ? &sim->running[t] : NULL, time);
+        }
+    }
+}
+
+/* Lets cpus that fall idle take work waiting on other cpus, or not.
+   Off unless turned on. */
+void sched_set_stealing(Simulator *sim, int stealing)
+{
+    assert(sim != NULL);
+    sim->stealing = stealing;
+}
+
+/* Runs the simulator under policy instead of shortest remaining time first.
+   Only before anything is submitted. */
+void sched_set_policy(Simulator *sim, const Policy *policy)
+{
+    assert(sim != NULL && policy != NULL);
+    assert(sim->pendingcount == 0 && sim->proc_remaining == 0);
+    sim->policy = *policy;
+    // the readyqueues are empty, so they are simply made anew in its order
+    for (int i = 0; i < sim->nprocessor; i++)
+    {
+        free_heap(sim->readyqueue[i]);
+        sim->readyqueue[i] = new_heap_ordered(sim->policy.before);
+    }
+}
+
+/* Logs every segment a process runs on a cpu to segments from the next
+   event on, or stops logging if segments is NULL. The log is not freed
+   with the simulator. */
+void sched_set_segmentlog(Simulator *sim, SegmentLog *segments)
+{
+    assert(sim != NULL);
+    sim->segments = segments;
+}
+
+/* Splits parallelisable processes as split chooses instead of into one
+   subprocess per cpu. Only before anything is submitted. */
+void sched_set_split(Simulator *sim, const Split *split)
+{
+    assert(sim != NULL && split != NULL);
+    assert(sim->pendingcount == 0 && sim->proc_remaining == 0);
+    sim->split = *split;
+}
+
+/* Runs the subprocesses of a parallelisable process together, or not: each
+   on a different cpu, all starting at once and all preempted at once.
+   Off unless turned on. Only before anything is submitted. */
+void sched_set_gang(Simulator *sim, int gang)
+{
+    assert(sim != NULL);
+    assert(sim->pendingcount == 0 && sim->proc_remaining == 0);
+    sim->gang = gang;
+}
+
+/* Submits a process to arrive at its arrival time. Processes are admitted
+   in the order submitted, a process due before the time already reached
+   arriving straight away. Every process arriving at a time must be
+   submitted before the simulator is advanced to that time. */
+void sched_submit(Simulator *sim, Process process)
+{
+    assert(sim != NULL);
+    pending_push(sim, process);
+}
+
+/* Runs every event up to and including time: processes finishing and
+   submitted processes arriving. */
+void sched_advance_to(Simulator *sim, long long time)
+{
+    assert(sim != NULL);
+    long long next;
+
+    // jump straight from one arrival or completion to the next
+    while (next_event_time(sim, &next) && next <= time)
+    {
+        sched_step(sim, next);
+    }
+}
+
+/* Runs until every submitted process has finished. */
+void sched_drain(Simulator *sim)
+{
+    sched_advance_to(sim, LLONG_MAX);
+}
+
+/* Returns the time of the latest event run. */
+long long sched_time(Simulator *sim)
+{
+    assert(sim != NULL);
+    return sim->time;
+}
+
+/* Returns the statistics of the processes finished so far. */
+const Stats *sched_stats(Simulator *sim)
+{
+    assert(sim != NULL);
+    return &sim->stats;
+}
@@ -0,0 +1,118 @@
+/* * * * * * * *  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Description : Library for scheduling processes on a number of           *
+ *               processors under a pluggable policy, fed one process at a  *
+ *               time and advanced to any point in simulated time           *
+ * Layout by :  Matt Farrugia <matt.farrugia@unimelb.edu.au>                *
+ * Created by :Syed Ahammad Newaz Saif                                      *
+ * Email : snewaz@student.unimelb.edu.au                                    *
+ * Student ID : 684933                                                      *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * * */
+
+#ifndef SCHED_H
+#define SCHED_H
+
+#include "data.h"
+#include "trace.h"
+#include "stats.h"
+#include "policy.h"
+#include "segmentlog.h"
+#include "split.h"
+
+/* Kinds of event a simulator reports. */
+#define SCHED_RUNNING 0
+#define SCHED_FINISHED 1
+
+/* * * * * * * * * * *
+ * TYPE DEFINITIONS  *
+ * * * * * * * * * * */
+
+/* A simulator is only handled through a pointer, its insides are private
+   to sched.c. */
+typedef struct simulator Simulator;
+typedef struct schedevent SchedEvent;
+
+/* Called with each event as it happens, and the context given to sched_new. */
+typedef void (*SchedCallback)(const SchedEvent *event, void *context);
+
+/* * * * * * * * * *
+ * DATA STRUCTURES *
+ * * * * * * * * * */
+
+/* A process (or subprocess) starting to run on a cpu, or a whole process
+   finishing. */
+struct schedevent
+{
+    int type;                   // SCHED_RUNNING or SCHED_FINISHED
+    long long time;
+    int processid;              // of the process, or the parent of a subprocess
+    int child;                  // which subprocess, when running one
+    char parallelisable;        // 'p' for a subprocess
+    long long remainingtime;    // when running
+    int cpu;                    // when running
+    int proc_remaining;         // when finished, processes yet to finish
+    long long arrivaltime;      // when finished
+    int nchild;                 // when finished, subprocesses it ran as, 1 if none
+};
+
+/* * * * * * * * * * * * *
+ * FUNCTION DEFINITIONS  *
+ * * * * * * * * * * * * */
+
+/* Creates a simulator of nprocessor processors at time 0 with nothing
+   submitted. callback, if not NULL, is called with every event.
+   Returns a pointer to it. */
+Simulator *sched_new(int nprocessor, SchedCallback callback, void *context);
+
+/* Destroys a simulator and everything it holds. */
+void sched_free(Simulator *sim);
+
+/* Lets cpus that fall idle take work waiting on other cpus, or not. At each
+   event an idle cpu takes the waiting process that runs first (by default the
+   one with the least remaining time) from the readyqueue with the most remaining time in total.
+   Off unless turned on. */
+void sched_set_stealing(Simulator *sim, int stealing);
+
+/* Runs the simulator under policy instead of shortest remaining time first.
+   Only before anything is submitted. */
+void sched_set_policy(Simulator *sim, const Policy *policy);
+
+/* Logs every segment a process runs on a cpu to segments from the next
+   event on, or stops logging if segments is NULL. The log is not freed
+   with the simulator. */
+void sched_set_segmentlog(Simulator *sim, SegmentLog *segments);
+
+/* Splits parallelisable processes as split chooses instead of into one
+   subprocess per cpu. Only before anything is submitted. */
+void sched_set_split(Simulator *sim, const Split *split);
+
+/* Runs the subprocesses of a parallelisable process together, or not: each
+   on a different cpu, all starting at once and all preempted at once.
+   Off unless turned on. Only before anything is submitted. */
+void sched_set_gang(Simulator *sim, int gang);
+
+/* Submits a process to arrive at its arrival time. Processes are admitted
+   in the order submitted, a process due before the time already reached
+   arriving straight away. Every process arriving at a time must be
+   submitted before the simulator is advanced to that time. */
+void sched_submit(Simulator *sim, Process process);
+
+/* Runs every event up to and including time: processes finishing and
+   submitted processes arriving. */
+void sched_advance_to(Simulator *sim, long long time);
+
+/* Runs until every submitted process has finished. */
+void sched_drain(Simulator *sim);
+
+/* Takes the parent process's data, its execution time and number of
+   processes = k to fill in the k subprocesses it is split into, the same
+   split the simulator makes.
+   Returns the parent process with child encapsulated. */
+Data *create_subprocess(Data *dataarray, Data newdata, long long executiontime, int k);
+
+/* Returns the time of the latest event run. */
+long long sched_time(Simulator *sim);
+
+/* Returns the statistics of the processes finished so far. */
+const Stats *sched_stats(Simulator *sim);
+
+#endif
@@ -0,0 +1,105 @@
+/* * * * * * * *  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Description : Module for the log of run segments, each the stretch of    *
+ *               time a process ran on a cpu without a switch, appended as  *
+ *               a simulation goes                                          *
+ * Layout by :  Matt Farrugia <matt.farrugia@unimelb.edu.au>                *
+ * Created by :Syed Ahammad Newaz Saif                                      *
+ * Email : snewaz@student.unimelb.edu.au                                    *
+ * Student ID : 684933                                                      *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * * */
+
+/* List of libraries for the assignment */
+#include <stdlib.h>
+#include <assert.h>
+#include "segmentlog.h"
+
+/* Initial number of segments a log has room for before it grows. */
+#define INITIAL_SEGMENTS 64
+
+/* * * * * * * * * * * * *
+ * FUNCTION DEFINITIONS  *
+ * * * * * * * * * * * * */
+
+/* Creates a new, empty log of nprocessor cpus and returns a pointer to it. */
+SegmentLog *new_segmentlog(int nprocessor)
+{
+    assert(nprocessor >= 1);
+    SegmentLog *log = malloc(sizeof *log);
+    assert(log);
+
+    log->segments = malloc(sizeof(Segment) * INITIAL_SEGMENTS);
+    log->open = malloc(sizeof(Segment) * nprocessor);
+    log->isopen = calloc(nprocessor, sizeof(int));
+    assert(log->segments && log->open && log->isopen);
+    log->size = 0;
+    log->capacity = INITIAL_SEGMENTS;
+    log->nprocessor = nprocessor;
+
+    return log;
+}
+
+/* Destroys a log and its associated memory. */
+void free_segmentlog(SegmentLog *log)
+{
+    assert(log != NULL);
+    free(log->segments);
+    free(log->open);
+    free(log->isopen);
+    free(log);
+}
+
+/* Notes what a cpu is running at time: running, or nothing if NULL. A
+   segment closes when its cpu falls idle or switches to another process
+   and opens when a process starts. Amortised O(1). */
+void segmentlog_update(SegmentLog *log, int cpu, const Data *running, long long time)
+{
+    assert(log != NULL && cpu >= 0 && cpu < log->nprocessor);
+    Segment *open = &log->open[cpu];
+
+    // the same process carrying on is the same segment
+    if (log->isopen[cpu] && running != NULL && open->processid == running->processid && open->child == running->child)
+    {
+        return;
+    }
+
+    if (log->isopen[cpu])
+    {
+        // segments that took no time are left out
+        if (time > open->start)
+        {
+            if (log->size == log->capacity)
+            {
+                log->capacity *= 2;
+                log->segments = realloc(log->segments, sizeof(Segment) * log->capacity);
+                assert(log->segments);
+            }
+            open->end = time;
+            log->segments[log->size++] = *open;
+        }
+        log->isopen[cpu] = 0;
+    }
+
+    if (running != NULL)
+    {
+        open->cpu = cpu;
+        open->parallelisable = running->parallelisable;
+        open->processid = running->processid;
+        open->child = running->child;
+        open->start = time;
+        log->isopen[cpu] = 1;
+    }
+}
+
+/* Returns the number of segments closed so far. */
+int segmentlog_size(SegmentLog *log)
+{
+    assert(log != NULL);
+    return log->size;
+}
+
+/* Returns the i-th segment closed. O(1). */
+const Segment *segmentlog_get(SegmentLog *log, int i)
+{
+    assert(log != NULL && i >= 0 && i < log->size);
+    return &log->segments[i];
+}
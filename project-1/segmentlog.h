@@ -0,0 +1,71 @@
+/* * * * * * * *  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Description : Module for the log of run segments, each the stretch of    *
+ *               time a process ran on a cpu without a switch, appended as  *
+ *               a simulation goes                                          *
+ * Layout by :  Matt Farrugia <matt.farrugia@unimelb.edu.au>                *
+ * Created by :Syed Ahammad Newaz Saif                                      *
+ * Email : snewaz@student.unimelb.edu.au                                    *
+ * Student ID : 684933                                                      *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * * */
+
+#ifndef SEGMENTLOG_H
+#define SEGMENTLOG_H
+
+#include "data.h"
+
+/* * * * * * * * * * *
+ * TYPE DEFINITIONS  *
+ * * * * * * * * * * */
+
+typedef struct segment Segment;
+typedef struct segmentlog SegmentLog;
+
+/* * * * * * * * * *
+ * DATA STRUCTURES *
+ * * * * * * * * * */
+
+/* A process (or subprocess) running on a cpu from start until end. */
+struct segment
+{
+    int cpu;
+    char parallelisable;    // 'p' for a subprocess
+    int processid;          // of the process, or the parent of a subprocess
+    int child;              // which subprocess
+    long long start;
+    long long end;
+};
+
+/* The segments closed so far, in the order they closed, and the one open
+   on each cpu. */
+struct segmentlog
+{
+    Segment *segments;
+    int size;
+    int capacity;
+    int nprocessor;
+    Segment *open;          // the segment running on each cpu
+    int *isopen;            // 1 if a cpu has a segment open
+};
+
+/* * * * * * * * * * * * *
+ * FUNCTION DEFINITIONS  *
+ * * * * * * * * * * * * */
+
+/* Creates a new, empty log of nprocessor cpus and returns a pointer to it. */
+SegmentLog *new_segmentlog(int nprocessor);
+
+/* Destroys a log and its associated memory. */
+void free_segmentlog(SegmentLog *log);
+
+/* Notes what a cpu is running at time: running, or nothing if NULL. A
+   segment closes when its cpu falls idle or switches to another process
+   and opens when a process starts. Amortised O(1). */
+void segmentlog_update(SegmentLog *log, int cpu, const Data *running, long long time);
+
+/* Returns the number of segments closed so far. */
+int segmentlog_size(SegmentLog *log);
+
+/* Returns the i-th segment closed. O(1). */
+const Segment *segmentlog_get(SegmentLog *log, int i);
+
+#endif
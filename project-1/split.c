@@ -0,0 +1,156 @@
+/* * * * * * * *  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Description : Module for the ways a parallelisable process can be split  *
+ *               into subprocesses, each choosing how many to make          *
+ * Layout by :  Matt Farrugia <matt.farrugia@unimelb.edu.au>                *
+ * Created by :Syed Ahammad Newaz Saif                                      *
+ * Email : snewaz@student.unimelb.edu.au                                    *
+ * Student ID : 684933                                                      *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * * */
+
+/* List of libraries for the assignment */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include "split.h"
+
+/* Helper function for one subprocess per cpu. */
+int split_all(const Split *split, long long executiontime, int nprocessor, LoadTree *load);
+
+/* Helper function for a fixed number of subprocesses, at most one per cpu. */
+int split_fixed(const Split *split, long long executiontime, int nprocessor, LoadTree *load);
+
+/* Helper function for no more subprocesses than units of execution time,
+   so none is mostly the overhead of splitting. */
+int split_work(const Split *split, long long executiontime, int nprocessor, LoadTree *load);
+
+/* Helper function for the number of subprocesses that finish soonest, each
+   going to the least loaded cpu left. */
+int split_cost(const Split *split, long long executiontime, int nprocessor, LoadTree *load);
+
+/* Helper function that orders loads, least first. */
+int compare_load(const void *a, const void *b);
+
+/* * * * * * * * * * * * *
+ * FUNCTION DEFINITIONS  *
+ * * * * * * * * * * * * */
+
+/* Returns the time each of k subprocesses of a process of executiontime
+   takes. */
+long long subprocess_time(long long executiontime, int k)
+{
+    assert(k >= 1);
+    return (executiontime + k - 1) / k + 1;
+}
+
+/* Helper function for one subprocess per cpu. */
+int split_all(const Split *split, long long executiontime, int nprocessor, LoadTree *load)
+{
+    return nprocessor;
+}
+
+/* Helper function for a fixed number of subprocesses, at most one per cpu. */
+int split_fixed(const Split *split, long long executiontime, int nprocessor, LoadTree *load)
+{
+    return (split->k < nprocessor) ? split->k : nprocessor;
+}
+
+/* Helper function for no more subprocesses than units of execution time,
+   so none is mostly the overhead of splitting. */
+int split_work(const Split *split, long long executiontime, int nprocessor, LoadTree *load)
+{
+    if (executiontime < 1)
+    {
+        return 1;
+    }
+    return (executiontime < nprocessor) ? (int)executiontime : nprocessor;
+}
+
+/* Helper function that orders loads, least first. */
+int compare_load(const void *a, const void *b)
+{
+    long long first = *(const long long *)a;
+    long long second = *(const long long *)b;
+    return (first > second) - (first < second);
+}
+
+/* Helper function for the number of subprocesses that finish soonest, each
+   going to the least loaded cpu left. */
+int split_cost(const Split *split, long long executiontime, int nprocessor, LoadTree *load)
+{
+    assert(load != NULL);
+    long long *loads = malloc(sizeof(long long) * nprocessor);
+    assert(loads);
+    for (int c = 0; c < nprocessor; c++)
+    {
+        loads[c] = loadtree_load(load, c);
+    }
+    qsort(loads, nprocessor, sizeof(long long), compare_load);
+
+    // k subprocesses finish when the k-th least loaded cpu gets through
+    // its load and then its subprocess, fewer of them on a tie
+    int best = 1;
+    long long soonest = loads[0] + subprocess_time(executiontime, 1);
+    for (int k = 2; k <= nprocessor; k++)
+    {
+        long long completion = loads[k - 1] + subprocess_time(executiontime, k);
+        if (completion < soonest)
+        {
+            soonest = completion;
+            best = k;
+        }
+    }
+    free(loads);
+    return best;
+}
+
+/* Returns the split into one subprocess per cpu, the default. */
+Split all_split()
+{
+    Split split = {"all", 0, 0, split_all};
+    return split;
+}
+
+/* Finds the split named by spec: 'all' (one subprocess per cpu), 'fixed:k'
+   (k of them, or one per cpu if fewer), 'work' (no more than the execution
+   time) or 'cost' (as many as finish soonest given the load on the cpus).
+   Returns 1 with the split filled in, 0 if there is no such split. */
+int find_split(const char *spec, Split *split)
+{
+    assert(spec != NULL && split != NULL);
+    const Split splits[] =
+    {
+        {"all", 0, 0, split_all},
+        {"fixed", 1, 0, split_fixed},
+        {"work", 0, 0, split_work},
+        {"cost", 0, 1, split_cost},
+    };
+    int nsplits = sizeof(splits) / sizeof(splits[0]);
+
+    // the name runs up to the number of subprocesses, if there is one
+    const char *colon = strchr(spec, ':');
+    size_t length = colon ? (size_t)(colon - spec) : strlen(spec);
+    for (int i = 0; i < nsplits; i++)
+    {
+        if (strlen(splits[i].name) != length || strncmp(spec, splits[i].name, length) != 0)
+        {
+            continue;
+        }
+        *split = splits[i];
+
+        // only a fixed split takes a number, and needs one
+        int k;
+        char extra;
+        if (split->k == 0)
+        {
+            return colon == NULL;
+        }
+        if (colon == NULL || sscanf(colon + 1, "%d%c", &k, &extra) != 1 || k < 1)
+        {
+            return 0;
+        }
+        split->k = k;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,55 @@
+/* * * * * * * *  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Description : Module for the ways a parallelisable process can be split  *
+ *               into subprocesses, each choosing how many to make          *
+ * Layout by :  Matt Farrugia <matt.farrugia@unimelb.edu.au>                *
+ * Created by :Syed Ahammad Newaz Saif                                      *
+ * Email : snewaz@student.unimelb.edu.au                                    *
+ * Student ID : 684933                                                      *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * * */
+
+#ifndef SPLIT_H
+#define SPLIT_H
+
+#include "loadtree.h"
+
+/* * * * * * * * * * *
+ * TYPE DEFINITIONS  *
+ * * * * * * * * * * */
+
+typedef struct split Split;
+
+/* * * * * * * * * *
+ * DATA STRUCTURES *
+ * * * * * * * * * */
+
+/* How many subprocesses a parallelisable process is split into. Each of k
+   subprocesses of a process of execution time x takes ceil(x / k) + 1. */
+struct split
+{
+    const char *name;
+    int k;          // subprocesses of a fixed split, 0 for the others
+    int adaptive;   // 1 if the number depends on the load of the cpus
+
+    // Returns the number of subprocesses, from 1 to nprocessor, for a
+    // process of executiontime arriving when the cpus have load outstanding.
+    int (*factor)(const Split *split, long long executiontime, int nprocessor, LoadTree *load);
+};
+
+/* * * * * * * * * * * * *
+ * FUNCTION DEFINITIONS  *
+ * * * * * * * * * * * * */
+
+/* Returns the split into one subprocess per cpu, the default. */
+Split all_split();
+
+/* Finds the split named by spec: 'all' (one subprocess per cpu), 'fixed:k'
+   (k of them, or one per cpu if fewer), 'work' (no more than the execution
+   time) or 'cost' (as many as finish soonest given the load on the cpus).
+   Returns 1 with the split filled in, 0 if there is no such split. */
+int find_split(const char *spec, Split *split);
+
+/* Returns the time each of k subprocesses of a process of executiontime
+   takes. */
+long long subprocess_time(long long executiontime, int k);
+
+#endif
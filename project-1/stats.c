@@ -0,0 +1,90 @@
+/* * * * * * * *  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Description : Module for the performance statistics of a simulation,    *
+ *               folded in one finished process at a time                   *
+ * Layout by :  Matt Farrugia <matt.farrugia@unimelb.edu.au>                *
+ * Created by :Syed Ahammad Newaz Saif                                      *
+ * Email : snewaz@student.unimelb.edu.au                                    *
+ * Student ID : 684933                                                      *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * * */
+
+/* List of libraries for the assignment */
+#include <stdlib.h>
+#include <assert.h>
+#include <math.h>
+#include "stats.h"
+
+/* * * * * * * * * * * * *
+ * FUNCTION DEFINITIONS  *
+ * * * * * * * * * * * * */
+
+/* Resets the statistics to no process finished. */
+void stats_init(Stats *stats)
+{
+    assert(stats != NULL);
+    stats->count = 0;
+    stats->totalturnaroundtime = 0.00;
+    stats->totaltimeoverhead = 0.00;
+    stats->maxtimeoverhead = 0.00;
+    stats->makespan = 0;
+    histogram_init(&stats->turnaroundtimes);
+    histogram_init(&stats->timeoverheads);
+}
+
+/* Folds in a process that arrived, ran for executiontime and finished at
+   completiontime. O(1). */
+void stats_add(Stats *stats, long long arrivaltime, long long executiontime, long long completiontime)
+{
+    assert(stats != NULL);
+    long long turnaroundtime = completiontime - arrivaltime;
+    double timeoverhead = (double)turnaroundtime / executiontime;
+
+    stats->count++;
+    stats->totalturnaroundtime += turnaroundtime;
+    stats->totaltimeoverhead += timeoverhead;
+    if (stats->maxtimeoverhead < timeoverhead)
+    {
+        stats->maxtimeoverhead = timeoverhead;
+    }
+    if (stats->makespan < completiontime)
+    {
+        stats->makespan = completiontime;
+    }
+    histogram_record(&stats->turnaroundtimes, turnaroundtime);
+    histogram_record(&stats->timeoverheads, llround(timeoverhead * OVERHEAD_SCALE));
+}
+
+/* Adds the processes folded into from onto into, as if they had all
+   been folded into into. */
+void stats_merge(Stats *into, const Stats *from)
+{
+    assert(into != NULL && from != NULL);
+    into->count += from->count;
+    into->totalturnaroundtime += from->totalturnaroundtime;
+    into->totaltimeoverhead += from->totaltimeoverhead;
+    if (into->maxtimeoverhead < from->maxtimeoverhead)
+    {
+        into->maxtimeoverhead = from->maxtimeoverhead;
+    }
+    if (into->makespan < from->makespan)
+    {
+        into->makespan = from->makespan;
+    }
+    histogram_merge(&into->turnaroundtimes, &from->turnaroundtimes);
+    histogram_merge(&into->timeoverheads, &from->timeoverheads);
+}
+
+/* Returns the average turnaround time of the processes folded in, 0 if
+   none have been. */
+double stats_average_turnaround(const Stats *stats)
+{
+    assert(stats != NULL);
+    return (stats->count > 0) ? stats->totalturnaroundtime / stats->count : 0;
+}
+
+/* Returns the average time overhead of the processes folded in, 0 if none
+   have been. */
+double stats_average_overhead(const Stats *stats)
+{
+    assert(stats != NULL);
+    return (stats->count > 0) ? stats->totaltimeoverhead / stats->count : 0;
+}
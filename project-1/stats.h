@@ -0,0 +1,64 @@
+/* * * * * * * *  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Description : Module for the performance statistics of a simulation,    *
+ *               folded in one finished process at a time                   *
+ * Layout by :  Matt Farrugia <matt.farrugia@unimelb.edu.au>                *
+ * Created by :Syed Ahammad Newaz Saif                                      *
+ * Email : snewaz@student.unimelb.edu.au                                    *
+ * Student ID : 684933                                                      *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * * */
+
+#ifndef STATS_H
+#define STATS_H
+
+#include "histogram.h"
+
+/* Time overheads are recorded in hundredths, as many places as are printed. */
+#define OVERHEAD_SCALE 100
+
+/* * * * * * * * * * *
+ * TYPE DEFINITIONS  *
+ * * * * * * * * * * */
+
+typedef struct stats Stats;
+
+/* * * * * * * * * *
+ * DATA STRUCTURES *
+ * * * * * * * * * */
+
+/* Running sums and maxima, enough for the averages at the end without
+   keeping anything per process. The histograms give the percentiles. */
+struct stats
+{
+    int count;                    // processes finished
+    double totalturnaroundtime;
+    double totaltimeoverhead;
+    double maxtimeoverhead;
+    long long makespan;           // latest completion time
+    Histogram turnaroundtimes;
+    Histogram timeoverheads;      // in OVERHEAD_SCALE parts of one
+};
+
+/* * * * * * * * * * * * *
+ * FUNCTION DEFINITIONS  *
+ * * * * * * * * * * * * */
+
+/* Resets the statistics to no process finished. */
+void stats_init(Stats *stats);
+
+/* Folds in a process that arrived, ran for executiontime and finished at
+   completiontime. O(1). */
+void stats_add(Stats *stats, long long arrivaltime, long long executiontime, long long completiontime);
+
+/* Adds the processes folded into from onto into, as if they had all
+   been folded into into. */
+void stats_merge(Stats *into, const Stats *from);
+
+/* Returns the average turnaround time of the processes folded in, 0 if
+   none have been. */
+double stats_average_turnaround(const Stats *stats);
+
+/* Returns the average time overhead of the processes folded in, 0 if none
+   have been. */
+double stats_average_overhead(const Stats *stats);
+
+#endif
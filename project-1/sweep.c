@@ -0,0 +1,102 @@
+/* * * * * * * *  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Description : Module for sweeping the simulation across traces, numbers  *
+ *               of processors and the challenge, runs shared out between   *
+ *               a pool of threads                                          *
+ * Layout by :  Matt Farrugia <matt.farrugia@unimelb.edu.au>                *
+ * Created by :Syed Ahammad Newaz Saif                                      *
+ * Email : snewaz@student.unimelb.edu.au                                    *
+ * Student ID : 684933                                                      *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * * */
+
+/* List of libraries for the assignment */
+#include <stdlib.h>
+#include <stdio.h>
+#include <assert.h>
+#include <unistd.h>
+#include "sweep.h"
+
+/* Helper function that each thread runs, taking runs until none are left. */
+void *sweep_worker(void *argument);
+
+/* * * * * * * * * * * * *
+ * FUNCTION DEFINITIONS  *
+ * * * * * * * * * * * * */
+
+/* Reads a range of processor counts of the form 'n' or 'from-to'.
+   Returns 1 if it is a valid range of at least one processor, 0 otherwise. */
+int parse_processor_range(const char *text, int *from, int *to)
+{
+    char extra;
+    if (sscanf(text, "%d-%d%c", from, to, &extra) == 2)
+    {
+        return *from >= 1 && *from <= *to;
+    }
+    if (sscanf(text, "%d%c", from, &extra) == 1)
+    {
+        *to = *from;
+        return *from >= 1;
+    }
+    return 0;
+}
+
+/* Returns the number of threads to run a sweep on, one per core online. */
+int sweep_default_threads()
+{
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    return (cores > 0) ? (int)cores : 1;
+}
+
+/* Helper function that each thread runs, taking runs until none are left. */
+void *sweep_worker(void *argument)
+{
+    SweepWork *work = argument;
+    while (1)
+    {
+        // claim the next run
+        pthread_mutex_lock(&work->lock);
+        int index = work->next++;
+        pthread_mutex_unlock(&work->lock);
+        if (index >= work->nruns)
+        {
+            return NULL;
+        }
+
+        // everything the run changes is its own
+        SweepRun *run = &work->runs[index];
+        work->simulate(run->trace, run->nprocessor, &run->stats);
+    }
+}
+
+/* Runs simulate on every one of the runs, nthreads of them at a time.
+   Each thread takes the next run not yet started until none are left.
+   Returns once all of them have finished. */
+void run_sweep(SweepRun *runs, int nruns, int nthreads, Simulate simulate)
+{
+    assert(runs != NULL || nruns == 0);
+    SweepWork work;
+    work.runs = runs;
+    work.nruns = nruns;
+    work.next = 0;
+    work.simulate = simulate;
+    pthread_mutex_init(&work.lock, NULL);
+
+    // no more threads than runs
+    if (nthreads > nruns)
+    {
+        nthreads = nruns;
+    }
+    pthread_t *threads = malloc(sizeof(pthread_t) * (nthreads > 0 ? nthreads : 1));
+    assert(threads);
+    for (int i = 0; i < nthreads; i++)
+    {
+        int created = pthread_create(&threads[i], NULL, sweep_worker, &work);
+        assert(created == 0);
+    }
+    for (int i = 0; i < nthreads; i++)
+    {
+        pthread_join(threads[i], NULL);
+    }
+
+    free(threads);
+    pthread_mutex_destroy(&work.lock);
+}
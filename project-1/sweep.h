@@ -0,0 +1,69 @@
+/* * * * * * * *  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Description : Module for sweeping the simulation across traces, numbers  *
+ *               of processors and the challenge, runs shared out between   *
+ *               a pool of threads                                          *
+ * Layout by :  Matt Farrugia <matt.farrugia@unimelb.edu.au>                *
+ * Created by :Syed Ahammad Newaz Saif                                      *
+ * Email : snewaz@student.unimelb.edu.au                                    *
+ * Student ID : 684933                                                      *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * * */
+
+#ifndef SWEEP_H
+#define SWEEP_H
+
+#include <pthread.h>
+#include "trace.h"
+#include "stats.h"
+
+/* * * * * * * * * * *
+ * TYPE DEFINITIONS  *
+ * * * * * * * * * * */
+
+typedef struct sweeprun SweepRun;
+typedef struct sweepwork SweepWork;
+
+/* Simulates trace on nprocessor processors, folding every process into stats. */
+typedef void (*Simulate)(Trace *trace, int nprocessor, Stats *stats);
+
+/* * * * * * * * * *
+ * DATA STRUCTURES *
+ * * * * * * * * * */
+
+/* One configuration of a sweep and, once run, its statistics. The trace is
+   shared read only with every other run on the same file. */
+struct sweeprun
+{
+    Trace *trace;
+    const char *filepath;
+    int nprocessor;
+    int challenge;      // 1 if the trace was planned for the challenge
+    Stats stats;
+};
+
+/* What the threads of a sweep share: the runs and the next one to start. */
+struct sweepwork
+{
+    SweepRun *runs;
+    int nruns;
+    int next;               // taken under the lock
+    pthread_mutex_t lock;
+    Simulate simulate;
+};
+
+/* * * * * * * * * * * * *
+ * FUNCTION DEFINITIONS  *
+ * * * * * * * * * * * * */
+
+/* Reads a range of processor counts of the form 'n' or 'from-to'.
+   Returns 1 if it is a valid range of at least one processor, 0 otherwise. */
+int parse_processor_range(const char *text, int *from, int *to);
+
+/* Returns the number of threads to run a sweep on, one per core online. */
+int sweep_default_threads();
+
+/* Runs simulate on every one of the runs, nthreads of them at a time.
+   Each thread takes the next run not yet started until none are left.
+   Returns once all of them have finished. */
+void run_sweep(SweepRun *runs, int nruns, int nthreads, Simulate simulate);
+
+#endif
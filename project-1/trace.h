@@ -0,0 +1,139 @@
+/* * * * * * * *  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Description : Module for the trace of processes read in, the cold side   *
+ *               table holding what is only needed on arrival and finish    *
+ * Layout by :  Matt Farrugia <matt.farrugia@unimelb.edu.au>                *
+ * Created by :Syed Ahammad Newaz Saif                                      *
+ * Email : snewaz@student.unimelb.edu.au                                    *
+ * Student ID : 684933                                                      *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * * */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdio.h>
+
+/* Outcomes of parsing a line of a trace. */
+#define PARSE_ERROR -1
+#define PARSE_BLANK 0
+#define PARSE_OK 1
+
+/* Leading bytes of a binary trace. */
+#define TRACE_MAGIC "ALLOCTR1"
+#define TRACE_MAGIC_LENGTH 8
+
+/* * * * * * * * * * *
+ * TYPE DEFINITIONS  *
+ * * * * * * * * * * */
+
+typedef struct process Process;
+typedef struct trace Trace;
+typedef struct traceheader TraceHeader;
+
+/* * * * * * * * * *
+ * DATA STRUCTURES *
+ * * * * * * * * * */
+
+/* A process as read in. Subprocesses share the record of their parent. */
+struct process
+{
+    long long arrivaltime;
+    long long executiontime;
+    int processid;
+    char parallelisable;
+};
+
+/* Header of a binary trace. It is followed by the columns of arrival times,
+   execution times (both long long), processids (int) and parallelisable
+   flags (char), each count long and in arrival order. Values are in the
+   byte order of the machine that wrote them. */
+struct traceheader
+{
+    char magic[TRACE_MAGIC_LENGTH];
+    int version;
+    int count;
+    long long totalexecutiontime;
+};
+
+/* The processes in order of arrival. A loaded trace holds all of them.
+   A streamed trace holds only the next one to arrive and reads the rest
+   from its file on demand, so its memory does not grow with its length.
+   A mapped trace reads each one out of the columns of a binary trace. */
+struct trace
+{
+    Process *processes;
+    int count;              // processes added (read so far when streaming)
+    int capacity;
+    long long totalexecutiontime;
+    FILE *file;             // open while streaming, NULL once loaded
+    const char *filepath;   // named in messages about malformed lines
+    int lineno;             // lines read so far when streaming
+
+    // the columns of a mapped binary trace, NULL otherwise
+    void *map;
+    size_t mapsize;
+    const long long *arrivaltimes;
+    const long long *executiontimes;
+    const int *processids;
+    const char *parallelisable;
+};
+
+/* * * * * * * * * * * * *
+ * FUNCTION DEFINITIONS  *
+ * * * * * * * * * * * * */
+
+/* Creates a new, empty trace and returns a pointer to it. */
+Trace *new_trace();
+
+/* Maps the file into memory. A binary trace is used in place. A text trace
+   has every process scanned straight out of the mapping. Each malformed
+   line, or row of a binary trace, and each process arriving before the
+   one above it is reported on stderr with its number.
+   Returns the loaded trace, or NULL if the file cannot be read, is a
+   truncated binary trace or has any malformed line or row. */
+Trace *load_trace(const char *filepath);
+
+/* Checks whether an open file starts as a binary trace, leaving it rewound.
+   Returns 1 if it does, 0 otherwise. */
+int trace_is_binary(FILE *file);
+
+/* Checks every process of a loaded or mapped trace as a line of a text
+   trace is checked, and that they are in order of arrival, reporting each
+   one that is not on stderr with its number.
+   Returns the number of processes reported. */
+int check_trace(Trace *trace);
+
+/* Writes a trace out as a binary trace at filepath.
+   Returns 1 on success, 0 if the file cannot be written. */
+int write_trace_binary(Trace *trace, const char *filepath);
+
+/* Copies the processes of a mapped trace into memory of its own so threads
+   can read it at once, and releases the mapping. Does nothing otherwise. */
+void trace_materialise(Trace *trace);
+
+/* Creates a trace that streams processes from an open file, one line at a
+   time as the simulation reaches them. The trace closes the file. */
+Trace *new_trace_stream(FILE *file, const char *filepath);
+
+/* Destroys a trace and its associated memory. */
+void free_trace(Trace *trace);
+
+/* Parses the line [line, end) of the form
+   'arrivaltime processid executiontime n|p', with times up to 64 bits.
+   Returns PARSE_OK with the process filled in, PARSE_BLANK for an empty
+   line, or PARSE_ERROR. */
+int parse_process(const char *line, const char *end, Process *process);
+
+/* Returns the process at position cursor in arrival order, or NULL once
+   the trace is exhausted. A streamed trace can only be walked forwards,
+   one position past the previous call at most. A malformed line met while
+   streaming, a line too long to read whole or a process arriving before
+   the one above it is reported and ends the program. The process returned by a
+   streamed or mapped trace is only valid until the next call. Any other
+   trace is only read, so it can be walked by many threads at once. */
+Process *trace_peek(Trace *trace, int cursor);
+
+/* Appends a process to a trace. Amortised O(1).
+   Returns the handle of the process. */
+int trace_add(Trace *trace, Process process);
+
+#endif